@@ -2,9 +2,10 @@
 * 	Button.c
 *
 * 	This source file is used to contain initialization and functionality of the
-* 	button on IC Checker v1.5 Shield. Software debouncing is completed in a state
-* 	machine structured task, with a minimum debouncing period of 2 time slice periods.
-* 	Debounced button press state can be fetched by simple function call.
+* 	button on IC Checker v1.5 Shield. Button edges on PC0 interrupt through EXTI
+* 	line 0, and each edge is debounced by a one-shot TIM6 period before the pin
+* 	is trusted. Debounced button press state can be fetched by simple function
+* 	call.
 *
 * 	MCU: STM32L053R8
 *
@@ -14,24 +15,23 @@
 *	12/08/2018:
 *	Updated and added comments.
 *
+* 	10/16/2026:
+* 	Replaced polled ButtonDBReadTask with EXTI edge interrupts debounced by
+* 	a TIM6 one-shot period, so presses register in BUTTON_DEBOUNCE_MS
+* 	whatever the super loop load. Added ButtonDebouncing.
+*
 * 	Created on: 12/08/2018
 * 	Author: Anthony Needles
 ******************************************************************************/
 #include "stm32l053xx.h"
 #include "Button.h"
 
-/********************************************************************
-* Private Global Variables
-********************************************************************/
-static uint8_t buttonLatch;
-// Latched debounced button press state, set when button denouncer
-// state enters BUTTON_VERF, cleared when read by ButtonGet()
-
 /********************************************************************
 * Private Definitions
 ********************************************************************/
-typedef enum{BUTTON_UP, BUTTON_EDGE, BUTTON_VERF, BUTTON_HELD} BUTTON_STATE_T;
-// Button debouncer state machine state enumerations
+typedef enum{BUTTON_UP, BUTTON_EDGE, BUTTON_HELD, BUTTON_RELEASE} BUTTON_STATE_T;
+// Button debouncer state machine state enumerations. BUTTON_EDGE and
+// BUTTON_RELEASE last one debounce period.
 
 #define BUTTON_STATE (GPIOC->IDR & GPIO_IDR_ID0_Msk)
 // Button state is determined by digital input state on PC0
@@ -39,11 +39,36 @@ typedef enum{BUTTON_UP, BUTTON_EDGE, BUTTON_VERF, BUTTON_HELD} BUTTON_STATE_T;
 #define BUTTON_PRESSED 0x0001
 // Expected bit field of BUTTON_STATE when button is pressed
 
+#define BUTTON_DEBOUNCE_MS 10
+// Time an edge must settle before the button level is trusted
+
+#define CLKCYCLES_ONE_MS 2097
+// Cycles per millisecond dependent on use of 2.097 MHz low-power MSI
+
+/********************************************************************
+* Private Global Variables
+********************************************************************/
+static volatile uint8_t buttonLatch;
+// Latched debounced button press state, set by TIM6 interrupt when a
+// press is confirmed, cleared when read by ButtonGet()
+
+static volatile BUTTON_STATE_T buttonState;
+// Button debouncer state, changed only by interrupts after ButtonInit
+
+/********************************************************************
+* Private Function Prototypes
+********************************************************************/
+static void buttonArmEdge(BUTTON_STATE_T);
+
 /********************************************************************
 * ButtonInit - Initializes button input
 *
 * Description:  Enables clock for GPIOC. Enables input mode for PC0 with
-* 				pull down.
+* 				pull down. PC0 is routed to EXTI line 0, and TIM6 is set
+* 				to count BUTTON_DEBOUNCE_MS once per start (one-pulse
+* 				mode, 1 ms ticks). The update request source is limited
+* 				to overflow, so loading the prescaler does not
+* 				interrupt. The button is then armed for a press.
 *
 * Return value: None
 *
@@ -52,100 +77,152 @@ typedef enum{BUTTON_UP, BUTTON_EDGE, BUTTON_VERF, BUTTON_HELD} BUTTON_STATE_T;
 void ButtonInit(void)
 {
 	RCC->IOPENR |= RCC_IOPENR_GPIOCEN;
+	RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+	RCC->APB1ENR |= RCC_APB1ENR_TIM6EN;
 
 	GPIOC->MODER &= ~(GPIO_MODER_MODE0);
 	GPIOC->PUPDR |= GPIO_PUPDR_PUPD0_1;
 
+	SYSCFG->EXTICR[0] &= ~(SYSCFG_EXTICR1_EXTI0);
+	SYSCFG->EXTICR[0] |= SYSCFG_EXTICR1_EXTI0_PC;
+
+	TIM6->CR1 = (TIM_CR1_OPM | TIM_CR1_URS);
+	TIM6->PSC = (CLKCYCLES_ONE_MS - 1U);
+	TIM6->ARR = (BUTTON_DEBOUNCE_MS - 1U);
+	TIM6->EGR = TIM_EGR_UG;
+	TIM6->SR = 0;
+	TIM6->DIER = TIM_DIER_UIE;
+
 	buttonLatch = NOT_PRESSED;
+
+	NVIC_EnableIRQ(EXTI0_1_IRQn);
+	NVIC_EnableIRQ(TIM6_DAC_IRQn);
+	buttonArmEdge(BUTTON_UP);
+}
+
+/********************************************************************
+* ButtonGet - Fetch function to return debounced button state
+*
+* Description:  Reads current latched value of button, and resets the
+* 				value if read as asserted. Returns the read state.
+* 				Interrupts are masked around the read and reset, so a
+* 				press latched in between is not lost.
+*
+* Return value:	State of debounced, latched button state.
+*
+* Arguments:    None
+********************************************************************/
+uint8_t ButtonGet(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint8_t button_temp;
+
+	__disable_irq();
+	button_temp = buttonLatch;
+	if(button_temp == PRESSED) buttonLatch = NOT_PRESSED;
+	__set_PRIMASK(primask);
+
+	return button_temp;
+}
+
+/********************************************************************
+* ButtonDebouncing - Tells whether an edge is being debounced
+*
+* Description:  TIM6 halts in Stop mode, so Stop mode should not be
+* 				entered while an edge is being debounced.
+*
+* Return value:	uint8_t - 1 while TIM6 counts a debounce period, 0
+* 				otherwise
+*
+* Arguments:    None
+********************************************************************/
+uint8_t ButtonDebouncing(void)
+{
+	return ((buttonState == BUTTON_EDGE) || (buttonState == BUTTON_RELEASE)) ? 1U : 0U;
 }
 
 /********************************************************************
-* ButtonDBReadTask - Task for reading and debouncing current button press
+* EXTI0_1_IRQHandler - Handles button edge interrupts
 *
-* Description:  Reads input port tied to button. Implements debouncing
-* 				state machine that waits for positive edge of button
-* 				press, then verifies press for 4*TIMESLICE_PERIOD_MS.
-* 				This is due to slice counter allowing entrance to task
-* 				every other time slice, and  the required two states of hold
-* 				required to reach verification. The latched button press
-* 				is then set (this is cleared when ButtonGet is called).
-* 				State stays in BUTTON_HELD until negative edge is detected.
+* Description:  An armed edge on PC0 (press when up, release when
+* 				held) disarms EXTI line 0, so bounces are ignored, and
+* 				starts the TIM6 debounce period. The edge wakes the MCU
+* 				from sleep or Stop mode.
 *
-* Return value:	None
+* Return value: None
 *
 * Arguments:    None
 ********************************************************************/
-void ButtonDBReadTask(void)
+void EXTI0_1_IRQHandler(void)
 {
-	static uint8_t slice_counter = 1;
-	static BUTTON_STATE_T button_state = BUTTON_UP;
-	uint32_t button_temp = BUTTON_STATE;
+	EXTI->IMR &= ~(EXTI_IMR_IM0);
+	EXTI->PR = EXTI_PR_PIF0;
 
-	if(slice_counter > 0)
+	buttonState = (buttonState == BUTTON_UP) ? BUTTON_EDGE : BUTTON_RELEASE;
+	TIM6->CNT = 0;
+	TIM6->CR1 |= TIM_CR1_CEN;
+}
+
+/********************************************************************
+* TIM6_DAC_IRQHandler - Handles end of debounce period
+*
+* Description:  After a press edge, a pin still pressed latches the
+* 				press and the button is armed for release. After a
+* 				release edge, a pin still released arms the button for
+* 				the next press. An edge that did not hold (a glitch)
+* 				leaves the button as it was before the edge.
+*
+* Return value: None
+*
+* Arguments:    None
+********************************************************************/
+void TIM6_DAC_IRQHandler(void)
+{
+	TIM6->SR &= ~(TIM_SR_UIF);
+
+	if(BUTTON_STATE == BUTTON_PRESSED)
 	{
-		slice_counter = 0;
-		switch(button_state)
-		{
-			case BUTTON_UP:
-				if(button_temp == BUTTON_PRESSED)
-				{
-					button_state = BUTTON_EDGE;
-				} else
-				{
-					button_state = BUTTON_UP;
-				}
-				break;
-
-			case BUTTON_EDGE:
-				if(button_temp == BUTTON_PRESSED)
-				{
-					button_state = BUTTON_VERF;
-				} else
-				{
-					button_state = BUTTON_UP;
-				}
-				break;
-
-			case BUTTON_VERF:
-				buttonLatch = PRESSED;
-
-				button_state = BUTTON_HELD;
-				break;
-
-			case BUTTON_HELD:
-				if(button_temp == BUTTON_PRESSED)
-				{
-					button_state = BUTTON_HELD;
-				} else
-				{
-					button_state = BUTTON_UP;
-				}
-				break;
-
-			default:
-				button_state = BUTTON_UP;
-				break;
-
-		}
+		if(buttonState == BUTTON_EDGE) buttonLatch = PRESSED;
+		buttonArmEdge(BUTTON_HELD);
 	} else
 	{
-		slice_counter++;
+		buttonArmEdge(BUTTON_UP);
 	}
 }
 
 /********************************************************************
-* ButtonGet - Fetch function to return debounced button state
+* buttonArmEdge - Arms EXTI line 0 for the edge leaving a state
 *
-* Description:  Reads current latched value of button, and resets the
-* 				value if read as asserted. Returns the read state.
+* Description:  BUTTON_UP arms the rising (press) edge and BUTTON_HELD
+* 				the falling (release) edge. If the pin already left the
+* 				state before the edge was armed, the edge would be
+* 				missed, so the debounce period is started right away.
 *
-* Return value:	State of debounced, latched button state.
+* Return value: None
 *
-* Arguments:    None
+* Arguments:    BUTTON_STATE_T state - BUTTON_UP or BUTTON_HELD
 ********************************************************************/
-uint8_t ButtonGet(void)
+static void buttonArmEdge(BUTTON_STATE_T state)
 {
-	uint8_t button_temp = buttonLatch;
-	if(button_temp == PRESSED) buttonLatch = NOT_PRESSED;
-	return button_temp;
+	buttonState = state;
+	EXTI->PR = EXTI_PR_PIF0;
+
+	if(state == BUTTON_UP)
+	{
+		EXTI->FTSR &= ~(EXTI_FTSR_FT0);
+		EXTI->RTSR |= EXTI_RTSR_RT0;
+	} else
+	{
+		EXTI->RTSR &= ~(EXTI_RTSR_RT0);
+		EXTI->FTSR |= EXTI_FTSR_FT0;
+	}
+	EXTI->IMR |= EXTI_IMR_IM0;
+
+	if((BUTTON_STATE == BUTTON_PRESSED) != (state == BUTTON_HELD))
+	{
+		EXTI->IMR &= ~(EXTI_IMR_IM0);
+		buttonState = (state == BUTTON_UP) ? BUTTON_EDGE : BUTTON_RELEASE;
+		TIM6->CNT = 0;
+		TIM6->CR1 |= TIM_CR1_CEN;
+	}
 }
@@ -11,6 +11,10 @@
 *	12/08/2018:
 *	Updated and added comments.
 *
+* 	10/16/2026:
+* 	Replaced ButtonDBReadTask with EXTI and TIM6 interrupt handlers. Added
+* 	ButtonDebouncing.
+*
 * 	Created on: 12/08/2018
 * 	Author: Anthony Needles
 ******************************************************************************/
@@ -26,7 +30,9 @@
 * ButtonInit - Initializes button input
 *
 * Description:  Enables clock for GPIOC. Enables input mode for PC0 with
-* 				pull down.
+* 				pull down. PC0 is routed to EXTI line 0, and TIM6 is set
+* 				to count one debounce period per start. The button is
+* 				then armed for a press.
 *
 * Return value: None
 *
@@ -35,33 +41,59 @@
 void ButtonInit(void);
 
 /********************************************************************
-* ButtonDBReadTask - Task for reading and debouncing current button press
+* ButtonGet - Fetch function to return debounced button state
 *
-* Description:  Reads input port tied to button. Implements debouncing
-* 				state machine that waits for positive edge of button
-* 				press, then verifies press for 4*TIMESLICE_PERIOD_MS.
-* 				This is due to slice counter allowing entrance to task
-* 				every other time slice, and  the required two states of hold
-* 				required to reach verification. The latched button press
-* 				is then set (this is cleared when ButtonGet is called).
-* 				State stays in BUTTON_HELD until negative edge is detected.
+* Description:  Reads current latched value of button, and resets the
+* 				value if read as asserted. Returns the read state.
+* 				Interrupts are masked around the read and reset, so a
+* 				press latched in between is not lost.
 *
-* Return value:	None
+* Return value:	State of debounced, latched button state.
 *
 * Arguments:    None
 ********************************************************************/
-void ButtonDBReadTask(void);
+uint8_t ButtonGet(void);
 
 /********************************************************************
-* ButtonGet - Fetch function to return debounced button state
+* ButtonDebouncing - Tells whether an edge is being debounced
 *
-* Description:  Reads current latched value of button, and resets the
-* 				value if read as asserted. Returns the read state.
+* Description:  TIM6 halts in Stop mode, so Stop mode should not be
+* 				entered while an edge is being debounced.
 *
-* Return value:	State of debounced, latched button state.
+* Return value:	uint8_t - 1 while TIM6 counts a debounce period, 0
+* 				otherwise
 *
 * Arguments:    None
 ********************************************************************/
-uint8_t ButtonGet(void);
+uint8_t ButtonDebouncing(void);
+
+/********************************************************************
+* EXTI0_1_IRQHandler - Handles button edge interrupts
+*
+* Description:  An armed edge on PC0 (press when up, release when
+* 				held) disarms EXTI line 0, so bounces are ignored, and
+* 				starts the TIM6 debounce period. The edge wakes the MCU
+* 				from sleep or Stop mode.
+*
+* Return value: None
+*
+* Arguments:    None
+********************************************************************/
+void EXTI0_1_IRQHandler(void);
+
+/********************************************************************
+* TIM6_DAC_IRQHandler - Handles end of debounce period
+*
+* Description:  After a press edge, a pin still pressed latches the
+* 				press and the button is armed for release. After a
+* 				release edge, a pin still released arms the button for
+* 				the next press. An edge that did not hold (a glitch)
+* 				leaves the button as it was before the edge.
+*
+* Return value: None
+*
+* Arguments:    None
+********************************************************************/
+void TIM6_DAC_IRQHandler(void);
 
 #endif /* BUTTON_H_ */
@@ -3,8 +3,9 @@
 *
 * 	This source file is used to contain all functionality and initialization for
 * 	performing the failure checking of 74HCXX digital logic integrated circuits.
-* 	Developed to work with IC Checker v1.5 Shield. Dependent on 2.097 MHz APB2
-* 	timer clock to perform delayed output readings.
+* 	Developed to work with IC Checker v1.5 Shield, fitted with a 20 pin ZIF
+* 	socket. Dependent on 2.097 MHz APB2 timer clock to perform delayed output
+* 	readings.
 *
 * 	MCU: STM32L053R8
 *
@@ -21,6 +22,167 @@
 * 	Completed test loop generic to IC, only needing IC parameters. Defines
 * 	for loop skipping created.
 *
+* 	10/16/2026:
+* 	Replaced per pin set/clear switches with precomputed vectors holding
+* 	one BSRR word per port, so each vector is applied with a single store
+* 	per port. Loop skipping defines removed.
+*
+* 	10/16/2026:
+* 	Added parallel gate testing. All gates are given the same input
+* 	combination and their outputs are checked from a single snapshot of
+* 	the port input registers. Per pin output read function removed.
+*
+* 	10/16/2026:
+* 	Added multi-candidate testing. Candidates sharing the same input pins
+* 	are tested together: each vector is applied once and every candidate
+* 	still alive is scored against the same reading. Vectors now hold the
+* 	level of every socket pin so any candidate pinout can be evaluated.
+*
+* 	10/16/2026:
+* 	Replaced checkerFailTest with a lookup into the candidate's packed
+* 	truth table, so checking costs the same for every IC type.
+*
+* 	10/16/2026:
+* 	Added CheckerWalkTree for identification with a generated decision tree.
+*
+* 	10/16/2026:
+* 	Replaced pin lookup switch with a constant socket pin map table.
+*
+* 	10/16/2026:
+* 	Pin directions are now set by checkerConfigSocket with a single MODER
+* 	write per port, and only when the direction of any pin changes.
+*
+* 	10/16/2026:
+* 	Gate input combinations are now created in Gray code order. Each
+* 	vector only writes the pins changed from the previous vector, and
+* 	carries its own settle delay chosen by the direction of the change.
+*
+* 	10/16/2026:
+* 	Outputs are now read once CHECKER_STABLE_SAMPLES port samples agree,
+* 	with the settle delay used as a timeout. Samples needed per read are
+* 	kept in settle statistics, given by CheckerSettleStats.
+*
+* 	10/16/2026:
+* 	Added CheckerMeasureTpd, which times gate output edges with TIM2 and
+* 	TIM22 input capture on the socket pins that have a capture channel.
+*
+* 	10/16/2026:
+* 	Added DMA vector playback. BSRR words are now held per port so DMA1,
+* 	paced by TIM2, can write each vector to the ports and capture the port
+* 	input registers without the CPU.
+*
+* 	10/16/2026:
+* 	Added CheckerDiagnoseIC, which runs every vector of an IC and maps
+* 	mismatches per gate and input combination. Vector application and
+* 	gate truth table indexing split out of CheckerTestGroup and
+* 	checkerTestCandidate so diagnosis shares them.
+*
+* 	10/16/2026:
+* 	Added CheckerScreenSocket, which finds undriven and shorted socket pins
+* 	with the GPIO pull resistors before any functional test.
+*
+* 	10/16/2026:
+* 	Added sequential test engine. CheckerTestSequence runs a clocked step
+* 	sequence held as data, and CheckerScreenSequences screens sequential
+* 	ICs with the same pin classification as CheckerScreenSocket.
+*
+* 	10/16/2026:
+* 	Socket widened to a 20 pin ZIF with every pin wired to a GPIO, so the
+* 	IC supply is driven by GPIO and 14, 16, and 20 pin packages with any
+* 	VCC and GND position are selected at runtime (CheckerSelectPackage).
+* 	Pin fields widened to PIN_FIELD_T and the capture map re-keyed by
+* 	socket pin. Vector levels and settle delays held in separate arrays to
+* 	save RAM.
+*
+* 	10/16/2026:
+* 	Added output stage checks. checkerReadDrive reads outputs with the
+* 	pull-down then the pull-up to tell driven high, driven low, and Hi-Z
+* 	apart, and checkerTestDrive uses it to check push-pull, tri-state, and
+* 	open-drain candidates after their truth table test. Open-drain outputs
+* 	are pulled up while tested. CheckerScreenSocket repeats its pull test
+* 	with every pin pulled up, so outputs left Hi-Z by pulled down inputs
+* 	are still seen driven.
+*
+* 	10/16/2026:
+* 	Added soak testing. CheckerStartSoak builds an IC's vectors and their
+* 	expected output levels once, then CheckerRunSoak reruns them as many
+* 	times as asked and counts failed reads per vector. MAX_TEST_VECTORS
+* 	made public as CHECKER_MAX_VECTORS.
+*
+* 	10/16/2026:
+* 	Added CheckerShmooIC, which reruns an IC's vectors with the TIM22
+* 	settle delay stepped down from CYCLES_DELAY and gives the shortest
+* 	delay it passes at. Outputs are read after the exact delay by
+* 	checkerReadSettled. Expected output levels split out of
+* 	CheckerStartSoak into checkerBuildExpect.
+*
+* 	10/16/2026:
+* 	Added CheckerSenseSocket, which senses an inserted IC with the socket
+* 	unpowered and weakly pulled. TIM22 delay split out of
+* 	checkerReadSettled into checkerWaitCycles.
+*
+* 	10/16/2026:
+* 	Candidates checked bit-sliced, 32 vectors at a time. Readings of a
+* 	block are transposed into one word per pin, and checkerTestBlock
+* 	evaluates each gate's truth table over whole words, replacing the per
+* 	vector checkerTestCandidate.
+*
+* 	10/16/2026:
+* 	Input and output pin fields read from IC_PARAMETERS_T, where they are
+* 	generated ahead by Tools/ICLibGen, replacing checkerInputField and
+* 	checkerOutputField.
+*
+* 	10/16/2026:
+* 	Group test split into CheckerStartGroup and CheckerStepGroup, which
+* 	check CHECKER_STEP_VECTORS vectors or one output stage per call and
+* 	keep their place in a CHECKER_GROUP_T, so callers can spread a test
+* 	over time slices. CheckerTestGroup runs the steps back to back. DMA
+* 	playback given a first vector, so each step plays only its own.
+*
+* 	10/16/2026:
+* 	Package table initialized from CHECKER_PACKAGE_PINS in Checker.h, which
+* 	Tools/ICLibGen shares.
+*
+* 	10/16/2026:
+* 	Added CheckerSensePackage, which finds the package of the inserted IC
+* 	with the socket unpowered, so only that package is ever powered. It
+* 	drives each VCC socket pin low in turn with every other pin pulled up
+* 	(checkerSenseLow). PACKAGE_NONE made public as CHECKER_PACKAGE_NONE,
+* 	and checkerSocketPin given the package's number of pins.
+*
+* 	10/16/2026:
+* 	Settle delay sweep split into CheckerStartShmoo and CheckerStepShmoo,
+* 	which read CHECKER_STEP_VECTORS vectors per call and keep their place
+* 	in a CHECKER_SHMOO_T. CheckerShmooIC runs the steps back to back.
+*
+* 	10/16/2026:
+* 	Diagnosis, sequential test, and delay measurement split the same way,
+* 	into CheckerStartDiagnosis and CheckerStepDiagnosis
+* 	(CHECKER_STEP_VECTORS vectors per call), CheckerStartSequence and
+* 	CheckerStepSequence (CHECKER_STEP_VECTORS steps per call), and
+* 	CheckerStartTpd and CheckerStepTpd (one gate per call).
+* 	CheckerDiagnoseIC, CheckerTestSequence, and CheckerMeasureTpd run the
+* 	steps back to back.
+*
+* 	10/16/2026:
+* 	checkerTestBlock compares each block with expected words generated
+* 	ahead by Tools/ICLibGen, replacing its truth table evaluation over
+* 	pin words. CheckerStartGroup builds the vectors of the whole group
+* 	the words were generated for, and CheckerTestIC takes a library and
+* 	index to find it.
+*
+* 	10/16/2026:
+* 	CheckerWalkTree ends the walk without narrowing if a node would drive
+* 	a pin the screen found driven by the IC.
+*
+* 	10/16/2026:
+* 	Removed the blocking wrappers (CheckerTestIC, CheckerTestGroup,
+* 	CheckerDiagnoseIC, CheckerShmooIC, CheckerTestSequence and
+* 	CheckerMeasureTpd), which had no callers.
+*
+* 	10/16/2026:
+* 	The bound on step run time is given once, with CHECKER_STEP_VECTORS.
+*
 * 	Created on: 12/09/2018
 * 	Author: Anthony Needles
 ******************************************************************************/
@@ -30,29 +192,228 @@
 /********************************************************************
 * Private Definitions
 ********************************************************************/
-#define INPUT_A_LOOP_SKIP (loop_skip_field & 0x01)
-#define INPUT_B_LOOP_SKIP ((loop_skip_field & 0x02) >> 1)
-#define INPUT_C_LOOP_SKIP ((loop_skip_field & 0x04) >> 2)
-#define INPUT_D_LOOP_SKIP ((loop_skip_field & 0x08) >> 3)
-//	Defines for determining required number of for loops based on the number of
-//	inputs per gate. A bit field of all 1s will be left shifted the number of inputs
-//	per gate for the given IC, with zeros shifting in at LSB (this is
-//	"loop_skip_field", where bits loop_skip_field[3:0] corresponds to whether [D:A]
-//	loops should be skipped or not, respectively). If "INPUT_X_LOOP_SKIP"
-//	evaluates to 1, then the loop will be skipped, but if evaluated to 0 will not.
-//	For example: The resulting loop_skip_field[3:0] for a two input gate will be
-//	0b1100, testing will require only the "gate_input_A" loop and the "gate_input_B"
-//	loop, so the "gate_input_C" loop and the "gate_input_D" loop will be "bypassed"
-//	by only executing once.
+#define NUM_PORTS 3
+#define PORT_A 0
+#define PORT_B 1
+#define PORT_C 2
+// Indices of GPIO ports wired to the IC socket. Used to index the per port
+// BSRR words of each test vector.
+
+#define SENSE_SOCKET_PIN CHECKER_MAX_PINS
+// Socket pin sensed by CheckerSenseSocket. Standard packages are top
+// aligned, so their VCC pin always lands on the last socket pin.
+
+#define PORT_NONE 0xFF
+// Port index of unused pin map entries
+
+#define BSRR_RESET_SHIFT 16
+// Bits [15:0] of BSRR set the corresponding ODR bit, bits [31:16] reset it
+
+#define TPD_CLOCK_MHZ 16
+// System and capture timer clock while measuring propagation delay (HSI16),
+// one timer tick is 62.5 ns
+
+#define TPD_SETTLE_TICKS 160
+#define TPD_TIMEOUT_TICKS 800
+// Wait before each measured edge (10 us) and longest wait for the output
+// edge (50 us), in ticks of TPD_CLOCK_MHZ
+
+#define TPD_LATENCY_TICKS 2
+// Ticks from reading the counter to the input edge reaching the socket,
+// including capture input resynchronization. Subtracted from every capture.
+
+#define NUM_DMA_READ_PORTS 2
+// Ports whose input data register is captured by DMA playback (A and B).
+// Groups reading a port C pin are tested by the CPU instead.
+
+#define DMA_REQ_TIM2 8
+// DMA1 channel selection of TIM2 requests on channels 1 to 5
+
+#define DMA_WRITE_TICKS 2
+#define DMA_READ_TICKS 2
+// TIM2 ticks from the first to the last BSRR write of a vector, and from
+// the input data register reads to the next vector
+
+#define SHMOO_MIN_CYCLES 1
+// Shortest settle delay swept by CheckerStepShmoo. TIM22 does not count with
+// an auto-reload value of zero.
+
+#define SHMOO_PASSES 4
+// Runs of the vector list at every settle delay of the sweep
+
+#define PULL_SETTLE_CYCLES CYCLES_DELAY
+// TIM22 cycles to wait at most for a socket pin to follow its pull
+// resistor (about 40 kOhm into the socket capacitance)
+
+#define PIN_LEVEL(field, ic_pin) (((field) >> (ic_pin)) & 0x01)
+// Logic level of a package pin in a pin field, where bit n of the field
+// corresponds to package pin n
+
+typedef struct {
+	uint8_t port_index;
+	uint8_t pin_bit;} PIN_MAP_T;
+// GPIO port index and bit number a pin is wired to
+
+typedef struct {
+	uint8_t ic_pin;
+	uint8_t port_index;
+	uint8_t pin_bit;} PIN_LOCATION_T;
+// Package pin number and the GPIO port index and bit number it is wired to
+
+typedef struct {
+	PIN_FIELD_T high_field;
+	PIN_FIELD_T low_field;} DRIVE_STATE_T;
+// Output pins found driving high and driving low by checkerReadDrive. Pins
+// in neither field followed both pulls and are Hi-Z.
+
+typedef struct {
+	TIM_TypeDef *timer;
+	uint8_t channel;
+	uint8_t alternate;} CAPTURE_MAP_T;
+// Timer, input capture channel, and GPIO alternate function number a
+// socket pin can be captured on. Timer is zero if the pin has none.
 
 /********************************************************************
 * Private Function Prototypes
 ********************************************************************/
-static void checkerSetClrInputs(uint8_t*, uint8_t, uint8_t, uint8_t);
-static void checkerSetICInput(uint8_t);
-static void checkerClrICInput(uint8_t);
-static uint8_t checkerReadICOutput(uint8_t);
-static uint8_t checkerFailTest(IC_DESIGNATOR_T, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+static uint8_t checkerSocketPin(uint8_t, uint8_t);
+static PIN_FIELD_T checkerSenseLow(uint8_t);
+static uint8_t checkerCountPins(PIN_FIELD_T);
+static uint8_t checkerScreenPins(PIN_FIELD_T, PIN_FIELD_T, CHECKER_SCREEN_T *);
+static uint8_t checkerBuildVectors(const IC_PARAMETERS_T *, uint8_t, uint32_t);
+static uint8_t checkerAddVector(PIN_FIELD_T, PIN_FIELD_T, uint8_t);
+static void checkerApplyVector(uint8_t);
+static void checkerPlayVectors(uint8_t, uint8_t);
+static uint8_t checkerStartVectors(uint8_t, uint8_t);
+static PIN_FIELD_T checkerVectorResponse(uint8_t, uint8_t);
+static void checkerConfigSocket(PIN_FIELD_T, PIN_FIELD_T);
+static void checkerDriveSocket(PIN_FIELD_T, PIN_FIELD_T);
+static void checkerPullSocket(PIN_FIELD_T, PIN_FIELD_T);
+static PIN_FIELD_T checkerReadOutputs(uint8_t);
+static PIN_FIELD_T checkerReadSettled(uint8_t);
+static void checkerWaitCycles(uint8_t);
+static void checkerReadDrive(PIN_FIELD_T, DRIVE_STATE_T *);
+static PIN_FIELD_T checkerOutputLevels(const uint32_t *);
+static void checkerBuildExpect(const IC_PARAMETERS_T *, uint8_t);
+static uint8_t checkerGateIndex(const uint8_t *, uint8_t, PIN_FIELD_T);
+static uint8_t checkerTestBlock(const IC_PARAMETERS_T *, const uint32_t *, uint8_t);
+static void checkerNextDrive(CHECKER_GROUP_T *);
+static uint8_t checkerTestDrive(const IC_PARAMETERS_T *);
+static void checkerSetFastClock(uint8_t);
+static uint16_t checkerCaptureEdge(const CAPTURE_MAP_T *, uint8_t, uint8_t, uint8_t);
+
+/********************************************************************
+* Private Global Variables
+********************************************************************/
+static PIN_FIELD_T checkerVectorLevels[CHECKER_MAX_VECTORS];
+static uint8_t checkerVectorSettle[CHECKER_MAX_VECTORS];
+// Test vectors of group currently under test, filled by
+// checkerBuildVectors(). Each holds the resulting level of every driven
+// pin as a pin field, and the TIM22 delay to wait before reading outputs.
+// Kept as two arrays, as a structure would pad each vector to 8 bytes.
+
+static uint32_t checkerVectorBsrr[NUM_PORTS][CHECKER_MAX_VECTORS];
+// BSRR word of every vector, one array per port so each can be played
+// back by a DMA channel
+
+static uint16_t checkerResponses[NUM_DMA_READ_PORTS][CHECKER_MAX_VECTORS];
+// Input data register of ports A and B after every vector, filled by
+// checkerPlayVectors()
+
+static PIN_FIELD_T checkerExpectLevels[CHECKER_MAX_VECTORS];
+// Expected output levels of every vector of the IC being soaked or swept,
+// filled by checkerBuildExpect()
+
+static PIN_LOCATION_T checkerOutputs[CHECKER_MAX_PINS];
+static uint8_t checkerNumOutputs;
+// Every package pin read as an output by any candidate of the group
+// currently under test, filled by checkerConfigSocket()
+
+static PIN_FIELD_T checkerDriveField;
+static PIN_FIELD_T checkerReadField;
+// Pin fields the socket is currently configured for by
+// checkerConfigSocket()
+
+static uint32_t checkerReadMasks[NUM_PORTS];
+// IDR bits of every read pin per port, filled by checkerConfigSocket()
+
+static CHECKER_SETTLE_STATS_T checkerSettleStats;
+// Output reading statistics, updated by checkerReadOutputs()
+
+static PIN_MAP_T checkerPinMap[CHECKER_MAX_PINS + 1];
+// Package pin to GPIO wiring of the selected package, indexed by package
+// pin. Built from checkerSocketMap by CheckerSelectPackage().
+
+static PIN_FIELD_T checkerIOField;
+// Pin field of package pins wired to a GPIO that may be driven or read
+// (all but VCC and GND), set by CheckerSelectPackage()
+
+static uint8_t checkerPackage;
+static uint8_t checkerNumPins;
+// Selected package and its number of pins
+
+/******************************************************************************
+* Private Constants
+******************************************************************************/
+static GPIO_TypeDef * const checkerPorts[NUM_PORTS] = {GPIOA, GPIOB, GPIOC};
+// GPIO port registers indexed by PORT_A, PORT_B, and PORT_C
+
+static const PIN_MAP_T checkerSocketMap[CHECKER_MAX_PINS + 1] = {
+	{PORT_NONE, 0},		// Unused, socket pins start at 1
+	{PORT_A, 10},		// Pin 1: PA10
+	{PORT_B, 3},		// Pin 2: PB3
+	{PORT_B, 5},		// Pin 3: PB5
+	{PORT_B, 4},		// Pin 4: PB4
+	{PORT_B, 10},		// Pin 5: PB10
+	{PORT_A, 8},		// Pin 6: PA8
+	{PORT_B, 12},		// Pin 7: PB12
+	{PORT_B, 13},		// Pin 8: PB13
+	{PORT_B, 14},		// Pin 9: PB14
+	{PORT_B, 15},		// Pin 10: PB15
+	{PORT_B, 0},		// Pin 11: PB0
+	{PORT_B, 1},		// Pin 12: PB1
+	{PORT_B, 2},		// Pin 13: PB2
+	{PORT_A, 9},		// Pin 14: PA9
+	{PORT_C, 7},		// Pin 15: PC7
+	{PORT_B, 6},		// Pin 16: PB6
+	{PORT_A, 7},		// Pin 17: PA7
+	{PORT_A, 6},		// Pin 18: PA6
+	{PORT_A, 5},		// Pin 19: PA5
+	{PORT_A, 4} };		// Pin 20: PA4
+// Socket pin to GPIO wiring of IC Checker shield, indexed by socket pin.
+// Every pin operation indexes the package pin map built from this table, so
+// a board revision only needs this table changed. A 14 pin IC keeps the
+// GPIOs of the original 14 pin socket, other than its supply pins.
+
+static const PACKAGE_PINS_T checkerPackages[CHECKER_NUM_PACKAGES] = CHECKER_PACKAGE_PINS;
+// Number of pins, VCC pin, and GND pin of each package, indexed by
+// CHECKER_PACKAGE_T (see Checker.h)
+
+static const CAPTURE_MAP_T checkerCaptureMap[CHECKER_MAX_PINS + 1] = {
+	{0, 0, 0},			// Unused, socket pins start at 1
+	{0, 0, 0},			// Pin 1: PA10, none
+	{TIM2, 2, 2},		// Pin 2: PB3, TIM2_CH2 AF2
+	{TIM22, 2, 4},		// Pin 3: PB5, TIM22_CH2 AF4
+	{TIM22, 1, 4},		// Pin 4: PB4, TIM22_CH1 AF4
+	{TIM2, 3, 2},		// Pin 5: PB10, TIM2_CH3 AF2
+	{0, 0, 0},			// Pin 6: PA8, none
+	{0, 0, 0},			// Pin 7: PB12, none
+	{0, 0, 0},			// Pin 8: PB13, none (TIM21 is used by LCD)
+	{0, 0, 0},			// Pin 9: PB14, none (TIM21 is used by LCD)
+	{0, 0, 0},			// Pin 10: PB15, none
+	{0, 0, 0},			// Pin 11: PB0, none
+	{0, 0, 0},			// Pin 12: PB1, none
+	{0, 0, 0},			// Pin 13: PB2, none
+	{0, 0, 0},			// Pin 14: PA9, none
+	{TIM22, 2, 0},		// Pin 15: PC7, TIM22_CH2 AF0
+	{0, 0, 0},			// Pin 16: PB6, none
+	{TIM22, 2, 5},		// Pin 17: PA7, TIM22_CH2 AF5
+	{TIM22, 1, 5},		// Pin 18: PA6, TIM22_CH1 AF5
+	{TIM2, 1, 5},		// Pin 19: PA5, TIM2_CH1 AF5
+	{0, 0, 0} };		// Pin 20: PA4, none
+// Input capture channel of each socket pin, indexed by socket pin. Used to
+// time gate output edges, so gates whose output pin has no channel can not
+// have their propagation delay measured.
 
 /********************************************************************
 * CheckerInit - Initializes required checker peripherals
@@ -62,6 +423,9 @@ static uint8_t checkerFailTest(IC_DESIGNATOR_T, uint8_t, uint8_t, uint8_t, uint8
 * 				in cycles. This timer will be used for delaying
 * 				small amounts to ensure any output gate change has
 * 				time to propagate the system. One pulse mode enabled.
+* 				Enables TIM2 clock for propagation delay capture and
+* 				DMA vector playback, and DMA1 clock. No package is
+* 				selected, so the socket is left unpowered.
 *
 * Return value:	None
 *
@@ -71,462 +435,2174 @@ void CheckerInit(void)
 {
 	RCC->IOPENR |= (RCC_IOPENR_GPIOAEN | RCC_IOPENR_GPIOBEN | RCC_IOPENR_GPIOCEN);
 	RCC->APB2ENR |= RCC_APB2ENR_TIM22EN;
+	RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+	RCC->AHBENR |= RCC_AHBENR_DMAEN;
 
 	TIM22->CR1 |= TIM_CR1_OPM;
 	TIM22->ARR = CYCLES_DELAY;
+
+	checkerPackage = CHECKER_PACKAGE_NONE;
 }
 
 /********************************************************************
-* CheckerTestIC - Task for reading and debouncing current button press
-*
-* Description:  Main test structure. Performs testing by creating all
-* 				possible input combinations and reading resulting outputs.
-* 				Made generically for any boolean logic 74HCXX IC with
-* 				four or less inputs per gate. Gate inputs are labeled
-* 				A, B, C, and D. For gates with less than four inputs,
-* 				the loops for unused inputs are bypassed (e.g. two
-* 				input gates will only use A and B loops). Only required
-* 				input pins are set/cleared. If tests fails at any point
-* 				failure result is immediately sent.
+* CheckerSelectPackage - Maps and powers the socket for a package
 *
+* Description:  Packages sit top aligned in the 20 pin socket, so the
+* 				first half of their pins start at socket pin 1 and the
+* 				second half end at socket pin 20. Every socket pin is
+* 				first set to input with no pull, removing the supply of
+* 				the previous package. The package pin map and IO pin
+* 				field are then rebuilt, and the package's GND and VCC
+* 				pins are driven low and high. Functions taking an IC
+* 				select its package themselves, and nothing is changed
+* 				if the package is already selected. Powering a package
+* 				other than the inserted IC's drives its pins, so the
+* 				package should first be sensed by CheckerSensePackage.
 *
-* Return value:	Test pass or test failure
+* Return value:	Pass, or failure if package is unknown
 *
-* Arguments:    IC_PARAMETERS_T IC - Structure holding IC parameters
+* Arguments:    uint8_t package - CHECKER_PACKAGE_T to select
 ********************************************************************/
-uint8_t CheckerTestIC(IC_PARAMETERS_T IC)
+uint8_t CheckerSelectPackage(uint8_t package)
 {
-	uint8_t num_gates = IC.num_outputs;
-	uint8_t num_inputs_gate = IC.num_inputs/IC.num_outputs;
-	uint8_t loop_skip_field = (0xFF << num_inputs_gate);
-	uint8_t gate_start_index = 0;
-	uint8_t test_output;
-	uint8_t fail_result;
-	uint8_t gate_num;
+	const PACKAGE_PINS_T *pins;
+	const PIN_MAP_T *vcc_map;
+	const PIN_MAP_T *gnd_map;
+	uint32_t port_mask[NUM_PORTS] = {0, 0, 0};
 
-	for(gate_num = 0; gate_num < num_gates; gate_num++)
-	{
-		for(uint8_t gate_input_A = INPUT_A_LOOP_SKIP; gate_input_A < 2; gate_input_A++)
-		{
-			for(uint8_t gate_input_B = INPUT_B_LOOP_SKIP; gate_input_B < 2; gate_input_B++)
-			{
-				for(uint8_t gate_input_C = INPUT_C_LOOP_SKIP; gate_input_C < 2; gate_input_C++)
-				{
-					for(uint8_t gate_input_D = INPUT_D_LOOP_SKIP; gate_input_D < 2; gate_input_D++)
-					{
-						if(INPUT_A_LOOP_SKIP != TRUE) checkerSetClrInputs(IC.input_pins, gate_input_A, gate_start_index, 0);
-						if(INPUT_B_LOOP_SKIP != TRUE) checkerSetClrInputs(IC.input_pins, gate_input_B, gate_start_index, 1);
-						if(INPUT_C_LOOP_SKIP != TRUE) checkerSetClrInputs(IC.input_pins, gate_input_C, gate_start_index, 2);
-						if(INPUT_D_LOOP_SKIP != TRUE) checkerSetClrInputs(IC.input_pins, gate_input_D, gate_start_index, 3);
+	if(package >= CHECKER_NUM_PACKAGES) return FAILED;
+	if(package == checkerPackage) return PASSED;
 
-						test_output = checkerReadICOutput(IC.output_pins[gate_num]);
+	for(uint8_t socket_pin = 1; socket_pin <= CHECKER_MAX_PINS; socket_pin++)
+	{
+		port_mask[checkerSocketMap[socket_pin].port_index] |= (GPIO_MODER_MODE0_Msk << (checkerSocketMap[socket_pin].pin_bit*2));
+	}
+	GPIOA->MODER &= ~port_mask[PORT_A];
+	GPIOB->MODER &= ~port_mask[PORT_B];
+	GPIOC->MODER &= ~port_mask[PORT_C];
+	GPIOA->PUPDR &= ~port_mask[PORT_A];
+	GPIOB->PUPDR &= ~port_mask[PORT_B];
+	GPIOC->PUPDR &= ~port_mask[PORT_C];
 
-						fail_result = checkerFailTest(IC.ic_designator, test_output, gate_input_A, gate_input_B, gate_input_C, gate_input_D);
+	pins = &checkerPackages[package];
+	checkerPackage = package;
+	checkerNumPins = pins->num_pins;
 
-						if(fail_result == FAILED) return FAILED;
-					}
-				}
-			}
-		}
-		gate_start_index += num_inputs_gate;
+	checkerPinMap[0] = checkerSocketMap[0];
+	checkerIOField = 0x00000000;
+	for(uint8_t ic_pin = 1; ic_pin <= checkerNumPins; ic_pin++)
+	{
+		checkerPinMap[ic_pin] = checkerSocketMap[checkerSocketPin(ic_pin, checkerNumPins)];
+		checkerIOField |= (1UL << ic_pin);
 	}
+	checkerIOField &= ~((1UL << pins->vcc_pin) | (1UL << pins->gnd_pin));
+
+	vcc_map = &checkerPinMap[pins->vcc_pin];
+	gnd_map = &checkerPinMap[pins->gnd_pin];
+	checkerPorts[gnd_map->port_index]->BSRR = (1UL << (gnd_map->pin_bit + BSRR_RESET_SHIFT));
+	checkerPorts[vcc_map->port_index]->BSRR = (1UL << vcc_map->pin_bit);
+	checkerPorts[gnd_map->port_index]->MODER |= (GPIO_MODER_MODE0_0 << (gnd_map->pin_bit*2));
+	checkerPorts[vcc_map->port_index]->MODER |= (GPIO_MODER_MODE0_0 << (vcc_map->pin_bit*2));
+
+	checkerDriveField = ~checkerIOField;
+	checkerReadField = ~checkerIOField;
 	return PASSED;
 }
 
 /********************************************************************
-* checkerSetClrInputs - Handles directing sets and clears of input pins
+* CheckerSenseSocket - Senses whether an IC is in the socket
 *
-* Description:  Handed input pin number array for given IC, whether to
-* 				set or clear, the index the current gate input group is
-* 				located in the pin number array, and which number input
-* 				of the gate is specified. This function derives
-* 				which specific IC pin is desired to set/clear based on
-* 				passed specifications, and calls set/clear functions.
+* Description:  Any selected package is deselected, leaving the socket
+* 				unpowered with every pin an input. Socket pin
+* 				SENSE_SOCKET_PIN, the VCC pin of every top aligned
+* 				standard package, is pulled down and every other pin
+* 				pulled up. An empty socket reads the pin low. An
+* 				inserted IC, even unpowered, ties its pins to its
+* 				supply rails through its protection diodes, so the
+* 				pulled up pins lift its VCC rail and the pin reads high
+* 				(an IC with VCC elsewhere, e.g. 74HC75, lifts the pin
+* 				through the diode from its GND rail instead). The pin
+* 				is read after PULL_SETTLE_CYCLES, and pulls are left in
+* 				place so the socket stays weakly pulled between calls.
 *
-* Return value:	None
+* Return value:	TRUE if an IC is sensed
 *
-* Arguments:    uint8_t *input_pins - Input IC pin number array (in
-* 				order) for tested IC.
+* Arguments:    None
+********************************************************************/
+uint8_t CheckerSenseSocket(void)
+{
+	const PIN_MAP_T *sense_map = &checkerSocketMap[SENSE_SOCKET_PIN];
+	uint32_t port_mask[NUM_PORTS] = {0, 0, 0};
+	uint32_t port_pull[NUM_PORTS] = {0, 0, 0};
+	uint8_t port_index;
+	uint8_t pin_bit;
+
+	for(uint8_t socket_pin = 1; socket_pin <= CHECKER_MAX_PINS; socket_pin++)
+	{
+		port_index = checkerSocketMap[socket_pin].port_index;
+		pin_bit = checkerSocketMap[socket_pin].pin_bit;
+
+		port_mask[port_index] |= (GPIO_MODER_MODE0_Msk << (pin_bit*2));
+		port_pull[port_index] |= (((socket_pin == SENSE_SOCKET_PIN) ? GPIO_PUPDR_PUPD0_1 : GPIO_PUPDR_PUPD0_0) << (pin_bit*2));
+	}
+	GPIOA->MODER &= ~port_mask[PORT_A];
+	GPIOB->MODER &= ~port_mask[PORT_B];
+	GPIOC->MODER &= ~port_mask[PORT_C];
+	GPIOA->PUPDR = (GPIOA->PUPDR & ~port_mask[PORT_A]) | port_pull[PORT_A];
+	GPIOB->PUPDR = (GPIOB->PUPDR & ~port_mask[PORT_B]) | port_pull[PORT_B];
+	GPIOC->PUPDR = (GPIOC->PUPDR & ~port_mask[PORT_C]) | port_pull[PORT_C];
+	checkerPackage = CHECKER_PACKAGE_NONE;
+
+	checkerWaitCycles(PULL_SETTLE_CYCLES);
+	return ((checkerPorts[sense_map->port_index]->IDR >> sense_map->pin_bit) & 0x01) ? TRUE : FALSE;
+}
+
+/********************************************************************
+* CheckerSensePackage - Finds the package of an unpowered IC
 *
-* 				uint8_t input_value - Desired value to give to input
-* 				pin (1 for set, 0 for clear).
+* Description:  Any selected package is deselected, leaving the socket
+* 				unpowered. For each socket pin that is the VCC pin of
+* 				a package, that pin is driven low and every other
+* 				socket pin pulled up (see checkerSenseLow). An IC
+* 				whose VCC pin is driven low pulls every one of its
+* 				other pins low through its protection diodes, its GND
+* 				pin through the diode between its supply rails. Empty
+* 				socket pins stay high, and so does the VCC pin of an
+* 				IC with its VCC elsewhere, which is on every package's
+* 				pins. A package is sensed when all its pins read low,
+* 				the package with the most pins if several are. Nothing
+* 				is driven high, so no IC pin is ever driven against,
+* 				and the socket is left with every pin pulled up.
 *
-* 				uint8_t gate_start - Index of pin number array that
-* 				current input group starts.
+* Return value:	CHECKER_PACKAGE_T sensed, or CHECKER_PACKAGE_NONE
 *
-* 				uint8_t input_offset - Offset of specific pin in input
-* 				group that is desired to be set/cleared.
+* Arguments:    None
 ********************************************************************/
-void checkerSetClrInputs(uint8_t *input_pins, uint8_t input_value, uint8_t gate_start, uint8_t input_offset)
+uint8_t CheckerSensePackage(void)
 {
-	if(input_value == 0)
+	const PACKAGE_PINS_T *pins;
+	PIN_FIELD_T low_field = 0x00000000;
+	PIN_FIELD_T package_field;
+	uint8_t sensed_package = CHECKER_PACKAGE_NONE;
+	uint8_t low_pin = 0;
+
+	checkerPackage = CHECKER_PACKAGE_NONE;
+	for(uint8_t package = 0; package < CHECKER_NUM_PACKAGES; package++)
 	{
-		checkerClrICInput(input_pins[gate_start + input_offset]);
-	} else if (input_value == 1)
+		pins = &checkerPackages[package];
+		if(checkerSocketPin(pins->vcc_pin, pins->num_pins) != low_pin)
+		{
+			low_pin = checkerSocketPin(pins->vcc_pin, pins->num_pins);
+			low_field = checkerSenseLow(low_pin);
+		}
+
+		package_field = 0x00000000;
+		for(uint8_t ic_pin = 1; ic_pin <= pins->num_pins; ic_pin++)
+		{
+			package_field |= CHECKER_PIN(checkerSocketPin(ic_pin, pins->num_pins));
+		}
+		if(((package_field & ~low_field) == 0) &&
+		   ((sensed_package == CHECKER_PACKAGE_NONE) || (pins->num_pins > checkerPackages[sensed_package].num_pins)))
+		{
+			sensed_package = package;
+		}
+	}
+	return sensed_package;
+}
+
+/********************************************************************
+* CheckerGroupField - Finds all candidates sharing an IC's input pins
+*
+* Description:  Compares the input pins of the given library entry
+* 				with every other entry. All entries of the same package
+* 				driven on exactly the same pins can share one set of
+* 				stimulus and are returned as one group.
+*
+* Return value:	Bit field of library entries in the group (bit n
+* 				corresponds to library[n])
+*
+* Arguments:    const IC_PARAMETERS_T *library - Array of candidate
+* 				IC parameters
+*
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				uint8_t ic_index - Index of library entry to group
+********************************************************************/
+uint32_t CheckerGroupField(const IC_PARAMETERS_T *library, uint8_t library_size, uint8_t ic_index)
+{
+	PIN_FIELD_T input_field = library[ic_index].input_field;
+	uint32_t group_field = 0x00000000;
+
+	for(uint8_t lib_index = 0; lib_index < library_size; lib_index++)
 	{
-		checkerSetICInput(input_pins[gate_start + input_offset]);
-	} else {}
+		if((library[lib_index].package == library[ic_index].package) &&
+		   (library[lib_index].input_field == input_field))
+		{
+			group_field |= (1UL << lib_index);
+		}
+	}
+	return group_field;
 }
 
 /********************************************************************
-* checkerSetICInput - Sets specific pins
+* CheckerStartGroup - Prepares a group test to be run in steps
 *
-* Description:  Based on which pin number given from specific IC's
-* 				input pin array, corresponding GPIO port is set to
-* 				output mode (relative to MCU, but these pins will be
-* 				inputs relative to the tested IC). The GPIO is then
-* 				set to high logic.
+* Description:  Vectors are built for every library entry sharing the
+* 				candidates' input pins (see CheckerGroupField and
+* 				checkerBuildVectors), even when only some are tested,
+* 				so they match the expected words generated for each
+* 				candidate. Duplicates are shared, and the group's
+* 				cursor is set to the first vector. Every candidate
+* 				starts alive, unless its pins can not be tested or its
+* 				expected words were generated for another vector list.
+* 				The vectors stay built until another function tests an
+* 				IC, so one group is tested at a time. Made generically
+* 				for any boolean logic 74HCXX IC with four or less
+* 				inputs per gate, so test time depends on the number of
+* 				distinct pinouts rather than the number of candidates.
 *
 * Return value:	None
 *
-* Arguments:    uint8_t ic_pin - IC pin desired to be set
-********************************************************************/
-void checkerSetICInput(uint8_t ic_pin)
-{
-	switch(ic_pin){
-		case 1:
-			GPIOA->MODER &= ~GPIO_MODER_MODE10_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE10_0;
-			GPIOA->ODR |= GPIO_ODR_OD10;
-		break;
-
-		case 2:
-			GPIOB->MODER &= ~GPIO_MODER_MODE3_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE3_0;
-			GPIOB->ODR |= GPIO_ODR_OD3;
-		break;
-
-		case 3:
-			GPIOB->MODER &= ~GPIO_MODER_MODE5_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE5_0;
-			GPIOB->ODR |= GPIO_ODR_OD5;
-		break;
-
-		case 4:
-			GPIOB->MODER &= ~GPIO_MODER_MODE4_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE4_0;
-			GPIOB->ODR |= GPIO_ODR_OD4;
-		break;
-
-		case 5:
-			GPIOB->MODER &= ~GPIO_MODER_MODE10_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE10_0;
-			GPIOB->ODR |= GPIO_ODR_OD10;
-		break;
-
-		case 6:
-			GPIOA->MODER &= ~GPIO_MODER_MODE8_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE8_0;
-			GPIOA->ODR |= GPIO_ODR_OD8;
-		break;
-
-		case 8:
-			GPIOA->MODER &= ~GPIO_MODER_MODE9_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE9_0;
-			GPIOA->ODR |= GPIO_ODR_OD9;
-		break;
-
-		case 9:
-			GPIOC->MODER &= ~GPIO_MODER_MODE7_Msk;
-			GPIOC->MODER |= GPIO_MODER_MODE7_0;
-			GPIOC->ODR |= GPIO_ODR_OD7;
-		break;
-
-		case 10:
-			GPIOB->MODER &= ~GPIO_MODER_MODE6_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE6_0;
-			GPIOB->ODR |= GPIO_ODR_OD6;
-		break;
-
-		case 11:
-			GPIOA->MODER &= ~GPIO_MODER_MODE7_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE7_0;
-			GPIOA->ODR |= GPIO_ODR_OD7;
-		break;
-
-		case 12:
-			GPIOA->MODER &= ~GPIO_MODER_MODE6_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE6_0;
-			GPIOA->ODR |= GPIO_ODR_OD6;
-		break;
-
-		case 13:
-			GPIOA->MODER &= ~GPIO_MODER_MODE5_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE5_0;
-			GPIOA->ODR |= GPIO_ODR_OD5;
-		break;
-
-		default:
-		break;
-	}
-}
-
-/********************************************************************
-* checkerClrICInput - Clears specific pins
-*
-* Description:  Based on which pin number given from specific IC's
-* 				input pin array, corresponding GPIO port is set to
-* 				output mode (relative to MCU, but these pins will be
-* 				inputs relative to the tested IC). The GPIO is then
-* 				set to low logic.
+* Arguments:    const IC_PARAMETERS_T *library - Array of candidate
+* 				IC parameters
 *
-* Return value:	None
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				uint32_t group_field - Bit field of library entries
+* 				to test, all sharing the same input pins
 *
-* Arguments:    uint8_t ic_pin - IC pin desired to be cleared
+* 				CHECKER_GROUP_T *group - Group test cursor to set
 ********************************************************************/
-void checkerClrICInput(uint8_t ic_pin)
+void CheckerStartGroup(const IC_PARAMETERS_T *library, uint8_t library_size, uint32_t group_field, CHECKER_GROUP_T *group)
 {
-	switch(ic_pin){
-		case 1:
-			GPIOA->MODER &= ~GPIO_MODER_MODE10_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE10_0;
-			GPIOA->ODR &= ~(GPIO_ODR_OD10);
-			break;
+	uint8_t first_index = 0;
 
-		case 2:
-			GPIOB->MODER &= ~GPIO_MODER_MODE3_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE3_0;
-			GPIOB->ODR &= ~(GPIO_ODR_OD3);
-			break;
+	while((first_index < library_size) && (((group_field >> first_index) & 0x01) == 0)) first_index++;
 
-		case 3:
-			GPIOB->MODER &= ~GPIO_MODER_MODE5_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE5_0;
-			GPIOB->ODR &= ~(GPIO_ODR_OD5);
-			break;
+	group->library = library;
+	group->library_size = library_size;
+	group->num_vectors = (first_index < library_size) ?
+						 checkerBuildVectors(library, library_size, CheckerGroupField(library, library_size, first_index)) : 0;
+	group->next_vector = 0;
+	group->next_drive = 0;
+	group->live_field = 0x00000000;
 
-		case 4:
-			GPIOB->MODER &= ~GPIO_MODER_MODE4_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE4_0;
-			GPIOB->ODR &= ~(GPIO_ODR_OD4);
-			break;
+	for(uint8_t lib_index = first_index; lib_index < library_size; lib_index++)
+	{
+		if((((group_field >> lib_index) & 0x01) != 0) && (group->num_vectors != 0) &&
+		   (library[lib_index].num_vectors == group->num_vectors))
+		{
+			group->live_field |= (1UL << lib_index);
+		}
+	}
 
-		case 5:
-			GPIOB->MODER &= ~GPIO_MODER_MODE10_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE10_0;
-			GPIOB->ODR &= ~(GPIO_ODR_OD10);
-			break;
+	checkerNextDrive(group);
+}
 
-		case 6:
-			GPIOA->MODER &= ~GPIO_MODER_MODE8_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE8_0;
-			GPIOA->ODR &= ~(GPIO_ODR_OD8);
-			break;
+/********************************************************************
+* CheckerStepGroup - Runs the next step of a group test
+*
+* Description:  While vectors are left and a candidate is alive, the
+* 				next CHECKER_STEP_VECTORS vectors (or fewer at the end)
+* 				are each applied once and the socket outputs read once,
+* 				either by the CPU or, with CHECKER_DMA_PLAYBACK, all at
+* 				once by DMA before any is checked (see
+* 				checkerPlayVectors). Readings are transposed into one
+* 				word per output pin, bit n holding the pin level at
+* 				vector n of the step, so every live candidate is
+* 				checked against the whole step at once (see
+* 				checkerTestBlock). A candidate that fails is cleared
+* 				from the live field and not checked again, and vectors
+* 				are skipped once no candidate is left. Each later step
+* 				then checks the output stage of one candidate still
+* 				alive (see checkerTestDrive).
+*
+* Return value:	TRUE once the group test is done, with the candidates
+* 				that passed left in the group's live field
+*
+* Arguments:    CHECKER_GROUP_T *group - Group test cursor from
+* 				CheckerStartGroup, updated
+********************************************************************/
+uint8_t CheckerStepGroup(CHECKER_GROUP_T *group)
+{
+	uint8_t block_start = group->next_vector;
+	uint8_t block_size = group->num_vectors - block_start;
+	uint8_t dma_playback;
+	uint32_t pin_words[CHECKER_MAX_PINS + 1];
+	PIN_FIELD_T pin_levels;
 
-		case 8:
-			GPIOA->MODER &= ~GPIO_MODER_MODE9_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE9_0;
-			GPIOA->ODR &= ~(GPIO_ODR_OD9);
-			break;
+	if((block_size != 0) && (group->live_field != 0))
+	{
+		if(block_size > CHECKER_STEP_VECTORS) block_size = CHECKER_STEP_VECTORS;
+		dma_playback = checkerStartVectors(block_start, block_size);
 
-		case 9:
-			GPIOC->MODER &= ~GPIO_MODER_MODE7_Msk;
-			GPIOC->MODER |= GPIO_MODER_MODE7_0;
-			GPIOC->ODR &= ~(GPIO_ODR_OD7);
-			break;
+		for(uint8_t ic_pin = 0; ic_pin <= CHECKER_MAX_PINS; ic_pin++)
+		{
+			pin_words[ic_pin] = 0;
+		}
 
-		case 10:
-			GPIOB->MODER &= ~GPIO_MODER_MODE6_Msk;
-			GPIOB->MODER |= GPIO_MODER_MODE6_0;
-			GPIOB->ODR &= ~(GPIO_ODR_OD6);
-			break;
+		for(uint8_t vector_offset = 0; vector_offset < block_size; vector_offset++)
+		{
+			pin_levels = checkerVectorResponse(block_start + vector_offset, dma_playback);
 
-		case 11:
-			GPIOA->MODER &= ~GPIO_MODER_MODE7_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE7_0;
-			GPIOA->ODR &= ~(GPIO_ODR_OD7);
-			break;
+			for(uint8_t ic_pin = 1; ic_pin <= CHECKER_MAX_PINS; ic_pin++)
+			{
+				pin_words[ic_pin] |= (PIN_LEVEL(pin_levels, ic_pin) << vector_offset);
+			}
+		}
 
-		case 12:
-			GPIOA->MODER &= ~GPIO_MODER_MODE6_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE6_0;
-			GPIOA->ODR &= ~(GPIO_ODR_OD6);
-			break;
+		for(uint8_t lib_index = 0; lib_index < group->library_size; lib_index++)
+		{
+			if(((group->live_field >> lib_index) & 0x01) == 0) continue;
 
-		case 13:
-			GPIOA->MODER &= ~GPIO_MODER_MODE5_Msk;
-			GPIOA->MODER |= GPIO_MODER_MODE5_0;
-			GPIOA->ODR &= ~(GPIO_ODR_OD5);
-			break;
+			if(checkerTestBlock(&group->library[lib_index], pin_words, block_start/CHECKER_STEP_VECTORS) == FAILED)
+			{
+				group->live_field &= ~(1UL << lib_index);
+			}
+		}
 
-		default:
-			break;
+		group->next_vector = (group->live_field != 0) ? (block_start + block_size) : group->num_vectors;
+	} else if(group->next_drive < group->library_size)
+	{
+		if(checkerTestDrive(&group->library[group->next_drive]) == FAILED)
+		{
+			group->live_field &= ~(1UL << group->next_drive);
+		}
+		group->next_drive++;
 	}
+
+	checkerNextDrive(group);
+	return ((group->next_vector >= group->num_vectors) && (group->next_drive >= group->library_size)) ? TRUE : FALSE;
 }
 
 /********************************************************************
-* checkerReadICOutput - Reads specific pins
+* CheckerStartDiagnosis - Prepares a diagnosis to be run in steps
+*
+* Description:  Builds the IC's vectors as a single candidate group,
+* 				clears every gate diagnosis, and sets the diagnosis'
+* 				cursor to the first vector. The diagnosis is left done,
+* 				with CHECKER_DIAG_NONE faulty gates, if the IC pins can
+* 				not be tested. The vectors stay built until another
+* 				function tests an IC.
 *
-* Description:  Based on which pin number given from specific IC's
-* 				output pin array, corresponding GPIO port is set to
-* 				input mode (relative to MCU, but these pins will be
-* 				outputs relative to the tested IC). TIM22 is enabled
-* 				and has update interrupt flag polled in order to
-* 				generate a delay of only a few clock cycles. This allows
-* 				any gate output changes time to propagate so that
-* 				readings are correct. The resulting read logic level
-* 				is then returned.
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters
 *
-* Return value:	Logic value read from GPIO input
+* 				GATE_DIAG_T *gate_diags - Array of CHECKER_MAX_GATES
+* 				gate diagnoses to fill by CheckerStepDiagnosis
 *
-* Arguments:    uint8_t ic_pin - IC pin desired to have logic level read
+* 				CHECKER_DIAG_T *diag - Diagnosis cursor to set
 ********************************************************************/
-uint8_t checkerReadICOutput(uint8_t ic_pin)
+void CheckerStartDiagnosis(const IC_PARAMETERS_T *IC, GATE_DIAG_T *gate_diags, CHECKER_DIAG_T *diag)
 {
-	switch(ic_pin){
-		case 1:
-			GPIOA->MODER &= ~(GPIO_MODER_MODE10);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOA->IDR & GPIO_IDR_ID10_Msk) >> 10);
-			break;
+	diag->IC = IC;
+	diag->gate_diags = gate_diags;
+	diag->num_vectors = checkerBuildVectors(IC, 1U, 0x00000001);
+	diag->next_vector = 0;
+	diag->num_faulty = (diag->num_vectors != 0) ? 0 : CHECKER_DIAG_NONE;
 
-		case 2:
-			GPIOB->MODER &= ~(GPIO_MODER_MODE3);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOB->IDR & GPIO_IDR_ID3_Msk) >> 3);
-			break;
+	for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+	{
+		gate_diags[gate_num].high_field = 0;
+		gate_diags[gate_num].low_field = 0;
+		gate_diags[gate_num].mismatch_field = 0;
+		gate_diags[gate_num].fault = GATE_OK;
+	}
+}
 
-		case 3:
-			GPIOB->MODER &= ~(GPIO_MODER_MODE5);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOB->IDR & GPIO_IDR_ID5_Msk) >> 5);
-			break;
+/********************************************************************
+* CheckerStepDiagnosis - Runs the next step of a diagnosis
+*
+* Description:  The next CHECKER_STEP_VECTORS vectors (or fewer at the
+* 				end) are applied and read, even after a mismatch. For
+* 				each gate, the output level read and any mismatch with
+* 				the truth table is recorded against the gate input
+* 				combination. Once every vector is read, each gate with
+* 				mismatches is classified as stuck at 0 if it never read
+* 				high, stuck at 1 if it never read low, and inconsistent
+* 				otherwise.
+*
+* Return value:	TRUE once the diagnosis is done, with the number of
+* 				faulty gates left in the diagnosis' num_faulty
+*
+* Arguments:    CHECKER_DIAG_T *diag - Diagnosis cursor from
+* 				CheckerStartDiagnosis, updated
+********************************************************************/
+uint8_t CheckerStepDiagnosis(CHECKER_DIAG_T *diag)
+{
+	const IC_PARAMETERS_T *IC = diag->IC;
+	uint8_t num_inputs_gate = IC->num_inputs/IC->num_outputs;
+	uint8_t block_start = diag->next_vector;
+	uint8_t block_size = diag->num_vectors - block_start;
+	uint8_t dma_playback;
+	PIN_FIELD_T read_levels;
+	PIN_FIELD_T pin_levels;
+	uint8_t tt_index;
+	uint8_t out_level;
+	const uint8_t *gate_pins;
+	GATE_DIAG_T *gate_diag;
 
-		case 4:
-			GPIOB->MODER &= ~(GPIO_MODER_MODE4);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOB->IDR & GPIO_IDR_ID4_Msk) >> 4);
-			break;
+	if(block_size == 0) return TRUE;
+	if(block_size > CHECKER_STEP_VECTORS) block_size = CHECKER_STEP_VECTORS;
 
-		case 5:
-			GPIOB->MODER &= ~(GPIO_MODER_MODE10);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOB->IDR & GPIO_IDR_ID10_Msk) >> 10);
-			break;
+	dma_playback = checkerStartVectors(block_start, block_size);
 
-		case 6:
-			GPIOA->MODER &= ~(GPIO_MODER_MODE8);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOA->IDR & GPIO_IDR_ID8_Msk) >> 8);
-			break;
+	for(uint8_t vector_num = block_start; vector_num < (block_start + block_size); vector_num++)
+	{
+		read_levels = checkerVectorResponse(vector_num, dma_playback);
+		pin_levels = checkerVectorLevels[vector_num];
+		gate_pins = IC->input_pins;
 
-		case 8:
-			GPIOA->MODER &= ~(GPIO_MODER_MODE9);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOA->IDR & GPIO_IDR_ID9_Msk) >> 9);
-			break;
+		for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+		{
+			gate_diag = &diag->gate_diags[gate_num];
+			tt_index = checkerGateIndex(gate_pins, num_inputs_gate, pin_levels);
+			out_level = PIN_LEVEL(read_levels, IC->output_pins[gate_num]);
 
-		case 9:
-			GPIOC->MODER &= ~(GPIO_MODER_MODE7);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOC->IDR & GPIO_IDR_ID7_Msk) >> 7);
-			break;
+			if(out_level != 0)
+			{
+				gate_diag->high_field |= (1U << tt_index);
+			} else
+			{
+				gate_diag->low_field |= (1U << tt_index);
+			}
 
-		case 10:
-			GPIOB->MODER &= ~(GPIO_MODER_MODE6);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOB->IDR & GPIO_IDR_ID6_Msk) >> 6);
-			break;
+			if(((IC->truth_table >> tt_index) & 0x01) != out_level)
+			{
+				gate_diag->mismatch_field |= (1U << tt_index);
+			}
 
-		case 11:
-			GPIOA->MODER &= ~(GPIO_MODER_MODE7);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOA->IDR & GPIO_IDR_ID7_Msk) >> 7);
-			break;
+			gate_pins += num_inputs_gate;
+		}
+	}
 
-		case 12:
-			GPIOA->MODER &= ~(GPIO_MODER_MODE6);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOA->IDR & GPIO_IDR_ID6_Msk) >> 6);
-			break;
+	diag->next_vector = block_start + block_size;
+	if(diag->next_vector < diag->num_vectors) return FALSE;
 
-		case 13:
-			GPIOA->MODER &= ~(GPIO_MODER_MODE5);
-			TIM22->CR1 |= TIM_CR1_CEN;
-			while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
-			return ((GPIOA->IDR & GPIO_IDR_ID5_Msk) >> 5);
-			break;
+	for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+	{
+		gate_diag = &diag->gate_diags[gate_num];
 
-		default:
-			return 0xFF;
-			break;
+		if(gate_diag->mismatch_field == 0) continue;
+
+		if(gate_diag->high_field == 0)
+		{
+			gate_diag->fault = GATE_STUCK_0;
+		} else if(gate_diag->low_field == 0)
+		{
+			gate_diag->fault = GATE_STUCK_1;
+		} else
+		{
+			gate_diag->fault = GATE_INCONSISTENT;
+		}
+		diag->num_faulty++;
 	}
+	return TRUE;
 }
 
 /********************************************************************
-* checkerFailTest - Compares current inputs and output from tested gate
-* 					to expected results
-*
-* Description:  Uses defined IC boolean functions to determine if given
-* 				inputs and output match result as expected. IC boolean
-* 				functions defined in Checker.h.
+* CheckerStartSoak - Prepares an IC for repeated testing
 *
-* Return value:	Pass or failure for specific IC tested
+* Description:  Builds the IC's vectors as CheckerStartDiagnosis does and
+* 				works out the expected output levels of every vector
+* 				from the truth table once, so each soak pass only has
+* 				to compare readings. Soak statistics are cleared. The
+* 				vectors stay built until another function tests an IC.
+* 				No vector is applied, so run time is bounded by
+* 				building CHECKER_MAX_VECTORS vectors or less.
 *
-* Arguments:    IC_DESIGNATOR_T ic_id - Enumeration of IC's designation
-* 				being tested
+* Return value:	Pass, or failure if IC pins can not be tested
 *
-* 				uint8_t out - Read output for given inputs
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters
 *
-* 				uint8_t in_A - Value given to gate_input_A
+* 				CHECKER_SOAK_T *soak - Soak statistics to clear
+********************************************************************/
+uint8_t CheckerStartSoak(const IC_PARAMETERS_T *IC, CHECKER_SOAK_T *soak)
+{
+	uint8_t num_vectors = checkerBuildVectors(IC, 1U, 0x00000001);
+
+	soak->num_passes = 0;
+	soak->num_failed_passes = 0;
+	soak->num_reads = 0;
+	soak->num_fails = 0;
+	soak->num_vectors = num_vectors;
+	for(uint8_t vector_num = 0; vector_num < CHECKER_MAX_VECTORS; vector_num++)
+	{
+		soak->vector_fails[vector_num] = 0;
+	}
+
+	if(num_vectors == 0) return FAILED;
+
+	checkerBuildExpect(IC, num_vectors);
+	return PASSED;
+}
+
+/********************************************************************
+* CheckerRunSoak - Reruns the vectors of a soaked IC
 *
-* 				uint8_t in_B - Value given to gate_input_B
+* Description:  Every pass applies and reads the whole vector list
+* 				built by CheckerStartSoak, by DMA playback when
+* 				possible, and compares each reading with its expected
+* 				levels. Unlike a group test, a pass does not stop at
+* 				a mismatch. Failed reads are counted per vector, and a
+* 				pass with any failed read is counted as a failed pass.
 *
-* 				uint8_t in_C - Value given to gate_input_C
+* Return value:	None
 *
-* 				uint8_t in_D - Value given to gate_input_D
+* Arguments:    CHECKER_SOAK_T *soak - Soak statistics from
+* 				CheckerStartSoak, updated
 *
+* 				uint16_t num_passes - Number of passes to run
 ********************************************************************/
-uint8_t checkerFailTest(IC_DESIGNATOR_T ic_id, uint8_t out, uint8_t in_A, uint8_t in_B, uint8_t in_C, uint8_t in_D)
+void CheckerRunSoak(CHECKER_SOAK_T *soak, uint16_t num_passes)
 {
-	switch(ic_id)
+	uint8_t num_vectors = soak->num_vectors;
+	uint8_t dma_playback;
+	uint8_t pass_failed;
+
+	for(uint16_t pass_num = 0; pass_num < num_passes; pass_num++)
 	{
-		case IC_74HC00:
-			if(IC_74HC00_FAIL) return FAILED;
-			break;
+		dma_playback = checkerStartVectors(0, num_vectors);
+		pass_failed = FALSE;
 
-		case IC_74HC02:
-			if(IC_74HC02_FAIL) return FAILED;
-			break;
+		for(uint8_t vector_num = 0; vector_num < num_vectors; vector_num++)
+		{
+			if(checkerVectorResponse(vector_num, dma_playback) != checkerExpectLevels[vector_num])
+			{
+				soak->vector_fails[vector_num]++;
+				soak->num_fails++;
+				pass_failed = TRUE;
+			}
+		}
 
-		case IC_74HC04:
-			if(IC_74HC04_FAIL) return FAILED;
-			break;
+		soak->num_passes++;
+		soak->num_reads += num_vectors;
+		if(pass_failed == TRUE) soak->num_failed_passes++;
+	}
+}
 
-		case IC_74HC08:
-			if(IC_74HC08_FAIL) return FAILED;
-			break;
+/********************************************************************
+* CheckerStartShmoo - Prepares a settle delay sweep to be run in steps
+*
+* Description:  Builds the IC's vectors and expected output levels as
+* 				CheckerStartSoak does, and sets the sweep's cursor to
+* 				the first vector at CYCLES_DELAY. The sweep is left
+* 				done if the IC pins can not be tested. The vectors stay
+* 				built until another function tests an IC.
+*
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters
+*
+* 				CHECKER_SHMOO_T *shmoo - Sweep cursor to set
+********************************************************************/
+void CheckerStartShmoo(const IC_PARAMETERS_T *IC, CHECKER_SHMOO_T *shmoo)
+{
+	shmoo->num_vectors = checkerBuildVectors(IC, 1U, 0x00000001);
+	shmoo->next_vector = 0;
+	shmoo->pass_num = 0;
+	shmoo->settle_cycles = (shmoo->num_vectors != 0) ? CYCLES_DELAY : 0;
+	shmoo->min_cycles = CHECKER_SHMOO_NONE;
 
-		case IC_74HC10:
-			if(IC_74HC10_FAIL) return FAILED;
-			break;
+	if(shmoo->num_vectors != 0) checkerBuildExpect(IC, shmoo->num_vectors);
+}
 
-		case IC_74HC20:
-			if(IC_74HC20_FAIL) return FAILED;
-			break;
+/********************************************************************
+* CheckerStepShmoo - Runs the next step of a settle delay sweep
+*
+* Description:  The next CHECKER_STEP_VECTORS vectors of the vector
+* 				list (or fewer at its end) are applied and read at the
+* 				sweep's settle delay. Unlike a normal test, outputs are
+* 				read once when the TIM22 one pulse delay ends rather
+* 				than as soon as they are stable (see
+* 				checkerReadSettled), so each read is exactly its delay
+* 				after the vector is applied. Once the list has been run
+* 				SHMOO_PASSES times, the delay is passed and the next
+* 				step starts over one TIM22 cycle shorter. The sweep
+* 				ends at the first failed read or after SHMOO_MIN_CYCLES
+* 				passes.
+*
+* Return value:	TRUE once the sweep is done, with the shortest passing
+* 				settle delay (or CHECKER_SHMOO_NONE) left in the
+* 				sweep's min_cycles
+*
+* Arguments:    CHECKER_SHMOO_T *shmoo - Sweep cursor from
+* 				CheckerStartShmoo, updated
+********************************************************************/
+uint8_t CheckerStepShmoo(CHECKER_SHMOO_T *shmoo)
+{
+	uint8_t block_end = shmoo->next_vector + CHECKER_STEP_VECTORS;
+	PIN_FIELD_T read_levels;
 
-		case IC_74HC27:
-			if(IC_74HC27_FAIL) return FAILED;
-			break;
+	if(shmoo->settle_cycles < SHMOO_MIN_CYCLES) return TRUE;
+	if(block_end > shmoo->num_vectors) block_end = shmoo->num_vectors;
 
-		case IC_74HC86:
-			if(IC_74HC86_FAIL) return FAILED;
-			break;
+	for(uint8_t vector_num = shmoo->next_vector; vector_num < block_end; vector_num++)
+	{
+		__disable_irq();
+		checkerApplyVector(vector_num);
+		read_levels = checkerReadSettled(shmoo->settle_cycles);
+		__enable_irq();
 
-		default:
-			return FAILED;
-			break;
+		if(read_levels != checkerExpectLevels[vector_num])
+		{
+			shmoo->settle_cycles = 0;
+			return TRUE;
+		}
 	}
-	return PASSED;
+
+	shmoo->next_vector = block_end;
+	if(shmoo->next_vector >= shmoo->num_vectors)
+	{
+		shmoo->next_vector = 0;
+		shmoo->pass_num++;
+		if(shmoo->pass_num >= SHMOO_PASSES)
+		{
+			shmoo->pass_num = 0;
+			shmoo->min_cycles = shmoo->settle_cycles;
+			shmoo->settle_cycles--;
+		}
+	}
+	return (shmoo->settle_cycles < SHMOO_MIN_CYCLES) ? TRUE : FALSE;
+}
+
+/********************************************************************
+* CheckerScreenSocket - Screens socket pins for opens and shorts
+*
+* Description:  Every IO pin of the selected package is set to input
+* 				with a pull-down, then each low pin in turn is switched
+* 				to a pull-up and back, so pulls on two ports never
+* 				change together (a transparent latch could otherwise
+* 				catch its D input). A pin that follows its pull is
+* 				undriven: an IC input, an unused pin, or a pin that
+* 				does not make contact. A pin that does not is driven by
+* 				an IC output (or shorted to one, or to a supply). The
+* 				same is repeated with every pin pulled up, and a pin is
+* 				driven if it was driven in either pass, so tri-state
+* 				and open-drain outputs left Hi-Z by one set of input
+* 				levels are driven by the other. Each undriven pin is
+* 				then driven high while the others stay pulled down, and
+* 				any other undriven pin reading high is shorted to it.
+* 				Pulls are removed afterwards. A library IC of the
+* 				selected package passes the screen when all its output
+* 				pins are driven, none of its input pins are driven, and
+* 				none of its pins are shorted.
+*
+* Return value:	Bit field of library ICs that passed the screen
+*
+* Arguments:    const IC_PARAMETERS_T *library - Array of candidate
+* 				IC parameters
+*
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				CHECKER_SCREEN_T *screen - Screen result to fill
+********************************************************************/
+uint32_t CheckerScreenSocket(const IC_PARAMETERS_T *library, uint8_t library_size, CHECKER_SCREEN_T *screen)
+{
+	const IC_PARAMETERS_T *IC;
+	uint32_t passed_field = 0x00000000;
+	PIN_FIELD_T driven_field = 0x00000000;
+	PIN_FIELD_T undriven_field;
+	PIN_FIELD_T pin_field;
+	PIN_FIELD_T pull_levels;
+	PIN_FIELD_T read_levels;
+	uint8_t followed;
+
+	checkerConfigSocket(0x00000000, checkerIOField);
+	for(uint8_t pull_pass = 0; pull_pass < 2U; pull_pass++)
+	{
+		pull_levels = (pull_pass == 0) ? 0x00000000 : checkerIOField;
+		checkerPullSocket(checkerIOField, pull_levels);
+		read_levels = checkerReadOutputs(PULL_SETTLE_CYCLES);
+
+		for(uint8_t ic_pin = 1; ic_pin <= checkerNumPins; ic_pin++)
+		{
+			pin_field = (1UL << ic_pin);
+			if(((pin_field & checkerIOField) == 0) || ((driven_field & pin_field) != 0)) continue;
+
+			followed = FALSE;
+			if(((read_levels ^ pull_levels) & pin_field) == 0)
+			{
+				checkerPullSocket(checkerIOField, pull_levels ^ pin_field);
+				followed = (((checkerReadOutputs(PULL_SETTLE_CYCLES) ^ pull_levels) & pin_field) != 0) ? TRUE : FALSE;
+				checkerPullSocket(checkerIOField, pull_levels);
+				(void)checkerReadOutputs(PULL_SETTLE_CYCLES);
+			}
+			if(followed == FALSE)
+			{
+				driven_field |= pin_field;
+			}
+		}
+	}
+	checkerPullSocket(checkerIOField, 0x00000000);
+
+	undriven_field = checkerIOField & ~driven_field;
+	screen->driven_field = driven_field;
+	screen->short_field = 0x00000000;
+	for(uint8_t ic_pin = 1; ic_pin <= checkerNumPins; ic_pin++)
+	{
+		pin_field = (1UL << ic_pin);
+		if((undriven_field & pin_field) == 0) continue;
+
+		checkerDriveSocket(pin_field, pin_field);
+		read_levels = (checkerReadOutputs(PULL_SETTLE_CYCLES) & undriven_field);
+		if(read_levels != 0)
+		{
+			screen->short_field |= (pin_field | read_levels);
+		}
+		checkerDriveSocket(pin_field, 0x00000000);
+	}
+	checkerConfigSocket(0x00000000, checkerIOField);
+	checkerPullSocket(0x00000000, 0x00000000);
+
+	screen->open_field = 0x00000000;
+	screen->stuck_field = 0x00000000;
+	screen->num_faults = CHECKER_MAX_PINS + 1U;
+	screen->package = checkerPackage;
+	for(uint8_t lib_index = 0; lib_index < library_size; lib_index++)
+	{
+		IC = &library[lib_index];
+		if(IC->package != checkerPackage) continue;
+
+		if(checkerScreenPins(IC->input_field, IC->output_field, screen) == PASSED)
+		{
+			passed_field |= (1UL << lib_index);
+		}
+	}
+	return passed_field;
+}
+
+/********************************************************************
+* CheckerScreenSequences - Screens sequential ICs against socket pins
+*
+* Description:  Applies the pass rule of CheckerScreenSocket to each
+* 				sequential IC of the screened package using the pin
+* 				classification it already made, so no pins are tested
+* 				again. The closest IC in the screen result is replaced
+* 				if a sequential IC is closer.
+*
+* Return value:	Bit field of sequential ICs that passed the screen
+*
+* Arguments:    const IC_SEQUENCE_T *library - Array of sequential IC
+* 				pins and test sequences
+*
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				CHECKER_SCREEN_T *screen - Result of
+* 				CheckerScreenSocket, updated
+********************************************************************/
+uint32_t CheckerScreenSequences(const IC_SEQUENCE_T *library, uint8_t library_size, CHECKER_SCREEN_T *screen)
+{
+	uint32_t passed_field = 0x00000000;
+
+	for(uint8_t lib_index = 0; lib_index < library_size; lib_index++)
+	{
+		if(library[lib_index].package != screen->package) continue;
+
+		if(checkerScreenPins(library[lib_index].input_field, library[lib_index].output_field, screen) == PASSED)
+		{
+			passed_field |= (1UL << lib_index);
+		}
+	}
+	return passed_field;
+}
+
+/********************************************************************
+* CheckerStartSequence - Prepares a sequential test to be run in steps
+*
+* Description:  The IC's package is selected, and the test's cursor is
+* 				set to the first step of the sequence. The test is left
+* 				done and failed if the IC pins can not be tested.
+*
+* Return value:	None
+*
+* Arguments:    const IC_SEQUENCE_T *IC - Structure holding IC pins
+* 				and test sequence
+*
+* 				CHECKER_SEQUENCE_T *sequence - Sequential test cursor
+* 				to set
+********************************************************************/
+void CheckerStartSequence(const IC_SEQUENCE_T *IC, CHECKER_SEQUENCE_T *sequence)
+{
+	sequence->IC = IC;
+	sequence->next_step = 0;
+	sequence->result = PASSED;
+
+	if((CheckerSelectPackage(IC->package) == FAILED) ||
+	   (((IC->input_field | IC->output_field) & ~checkerIOField) != 0))
+	{
+		sequence->next_step = IC->num_steps;
+		sequence->result = FAILED;
+	}
+}
+
+/********************************************************************
+* CheckerStepSequence - Runs the next steps of a sequential test
+*
+* Description:  The IC's input pins are driven and all other IO pins
+* 				read. For each of the next CHECKER_STEP_VECTORS steps
+* 				(or fewer at the end), the input levels are applied,
+* 				the clock pins are pulsed, and once the outputs settle
+* 				the checked outputs are compared with the expected
+* 				levels. The test ends failed at the first mismatch.
+* 				Each BSRR write is done in turn, so the step's data
+* 				inputs are set well before its clock edge. The IC keeps
+* 				its state between calls, as its pins stay driven.
+*
+* Return value:	TRUE once the test is done, with its result left in
+* 				the test's result
+*
+* Arguments:    CHECKER_SEQUENCE_T *sequence - Sequential test cursor
+* 				from CheckerStartSequence, updated
+********************************************************************/
+uint8_t CheckerStepSequence(CHECKER_SEQUENCE_T *sequence)
+{
+	const IC_SEQUENCE_T *IC = sequence->IC;
+	const CHECKER_SEQ_STEP_T *step;
+	uint8_t num_steps = IC->num_steps - sequence->next_step;
+
+	if(num_steps > CHECKER_STEP_VECTORS) num_steps = CHECKER_STEP_VECTORS;
+
+	for(uint8_t step_count = 0; step_count < num_steps; step_count++)
+	{
+		step = &IC->steps[sequence->next_step];
+
+		checkerDriveSocket(IC->input_field, step->level_field);
+		if(step->clock_field != 0)
+		{
+			checkerDriveSocket(IC->input_field, step->level_field ^ step->clock_field);
+			checkerDriveSocket(IC->input_field, step->level_field);
+		}
+
+		if(((checkerReadOutputs(CYCLES_DELAY) ^ step->expect_field) & step->check_field) != 0)
+		{
+			sequence->next_step = IC->num_steps;
+			sequence->result = FAILED;
+			return TRUE;
+		}
+		sequence->next_step++;
+	}
+	return (sequence->next_step >= IC->num_steps) ? TRUE : FALSE;
+}
+
+/********************************************************************
+* CheckerWalkTree - Narrows candidates with a decision tree
+*
+* Description:  Starting from the given link, each node's vector is
+* 				applied to the socket and its read pin is sampled to
+* 				choose the next link, until a leaf is reached. Each node
+* 				is generated to split the remaining candidates as evenly
+* 				as possible, so only a few vectors are needed. The leaf's
+* 				candidates still have to be confirmed with a full test.
+* 				The tree's package (IC_TREE_PACKAGE) must be selected.
+* 				Nodes never drive an output pin of a candidate they
+* 				split, but a node that would drive a pin the screen
+* 				found driven by the IC ends the walk with every
+* 				candidate left, to be group tested instead.
+*
+* Return value:	Bit field of candidates left at the leaf reached, or
+* 				every bit set if the walk was ended early
+*
+* Arguments:    const CHECKER_TREE_NODE_T *tree - Array of tree nodes
+*
+* 				const uint32_t *leaf_fields - Array of candidate bit
+* 				fields, one per leaf
+*
+* 				uint8_t root - Link to first node (or leaf)
+*
+* 				PIN_FIELD_T driven_field - Pins driven by the IC, from
+* 				CheckerScreenSocket
+********************************************************************/
+uint32_t CheckerWalkTree(const CHECKER_TREE_NODE_T *tree, const uint32_t *leaf_fields, uint8_t root, PIN_FIELD_T driven_field)
+{
+	uint8_t link = root;
+	const CHECKER_TREE_NODE_T *node;
+
+	while((link & CHECKER_TREE_LEAF) == 0)
+	{
+		node = &tree[link];
+		if((node->drive_field & driven_field) != 0) return 0xFFFFFFFF;
+
+		checkerDriveSocket(node->drive_field, node->level_field);
+
+		link = node->next[PIN_LEVEL(checkerReadOutputs(CYCLES_DELAY), node->read_pin)];
+	}
+	return leaf_fields[link & ~CHECKER_TREE_LEAF];
+}
+
+/********************************************************************
+* CheckerSettleStats - Gives output reading statistics
+*
+* Description:  Gives the number of port samples each output reading
+* 				needed before CHECKER_STABLE_SAMPLES agreed, which
+* 				tracks the real propagation delay of the IC in the
+* 				socket. main.c sends them after each result (see
+* 				SendSettle).
+*
+* Return value:	Pointer to settle statistics
+*
+* Arguments:    None
+********************************************************************/
+const CHECKER_SETTLE_STATS_T *CheckerSettleStats(void)
+{
+	return &checkerSettleStats;
+}
+
+/********************************************************************
+* CheckerStartTpd - Prepares a delay measurement to be run in steps
+*
+* Description:  The IC's package is selected and the socket is
+* 				configured for the IC, then an input combination and
+* 				gate input whose change toggles the gate output are
+* 				found from the truth table. Open-drain outputs are
+* 				pulled up. The measurement is left done, with no gates,
+* 				if the IC pins can not be tested.
+*
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters, should be an IC that passed its test
+*
+* 				uint16_t *tpd_ns - Array of CHECKER_MAX_GATES delays
+* 				to fill by CheckerStepTpd
+*
+* 				CHECKER_TPD_T *tpd - Delay measurement cursor to set
+********************************************************************/
+void CheckerStartTpd(const IC_PARAMETERS_T *IC, uint16_t *tpd_ns, CHECKER_TPD_T *tpd)
+{
+	PIN_FIELD_T pull_field;
+	uint8_t num_inputs_gate = IC->num_inputs/IC->num_outputs;
+	uint8_t base_combo = 0;
+	uint8_t edge_input = 0;
+
+	tpd->IC = IC;
+	tpd->tpd_ns = tpd_ns;
+	tpd->next_gate = 0;
+	tpd->num_gates = 0;
+
+	if(CheckerSelectPackage(IC->package) == FAILED) return;
+	if((IC->input_field | IC->output_field) & ~checkerIOField) return;
+
+	pull_field = (IC->output_type == OUTPUT_OPEN_DRAIN) ? IC->output_field : 0x00000000;
+	checkerPullSocket(pull_field, pull_field);
+
+	for(uint8_t combo = 0; combo < (1U << num_inputs_gate); combo++)
+	{
+		for(edge_input = 0; edge_input < num_inputs_gate; edge_input++)
+		{
+			if(((IC->truth_table >> combo) & 0x01) != ((IC->truth_table >> (combo ^ (1U << edge_input))) & 0x01)) break;
+		}
+		base_combo = combo;
+		if(edge_input < num_inputs_gate) break;
+	}
+
+	tpd->base_combo = base_combo;
+	tpd->edge_input = edge_input;
+	tpd->num_gates = IC->num_outputs;
+}
+
+/********************************************************************
+* CheckerStepTpd - Measures the next gate of a delay measurement
+*
+* Description:  If the next gate's output pin has a timer capture
+* 				channel (see checkerCaptureMap), the output pin is
+* 				switched to the timer alternate function, the gate is
+* 				driven to the measurement's input combination, and the
+* 				input is changed and changed back, timing both output
+* 				edges. The slower edge is the gate's delay. Only the
+* 				falling edge of open-drain outputs is used, as the
+* 				rising edge is the pull-up charging the pin. The gate
+* 				is measured from HSI16 with interrupts disabled so
+* 				timing is not disturbed, and the timer and system clock
+* 				are restored afterwards. Delays shorter than one tick
+* 				of TPD_CLOCK_MHZ read as zero.
+*
+* Return value:	TRUE once every gate has been measured
+*
+* Arguments:    CHECKER_TPD_T *tpd - Delay measurement cursor from
+* 				CheckerStartTpd, updated. Its delay array is filled in
+* 				nanoseconds, CHECKER_TPD_NONE for gates that can not be
+* 				measured.
+********************************************************************/
+uint8_t CheckerStepTpd(CHECKER_TPD_T *tpd)
+{
+	const IC_PARAMETERS_T *IC = tpd->IC;
+	const CAPTURE_MAP_T *capture;
+	GPIO_TypeDef *port;
+	PIN_FIELD_T input_field = IC->input_field;
+	PIN_FIELD_T pin_levels;
+	uint16_t first_ticks;
+	uint16_t second_ticks;
+	uint32_t timer_cr1;
+	uint8_t num_inputs_gate = IC->num_inputs/IC->num_outputs;
+	uint8_t base_combo = tpd->base_combo;
+	uint8_t edge_input = tpd->edge_input;
+	uint8_t gate_num = tpd->next_gate;
+	uint8_t base_level;
+	uint8_t out_level;
+	uint8_t in_pin;
+	uint8_t out_pin;
+	uint8_t pin_bit;
+	uint8_t channel_num;
+
+	if(gate_num >= tpd->num_gates) return TRUE;
+	tpd->next_gate++;
+	tpd->tpd_ns[gate_num] = CHECKER_TPD_NONE;
+
+	out_pin = IC->output_pins[gate_num];
+	capture = &checkerCaptureMap[checkerSocketPin(out_pin, checkerNumPins)];
+	if((capture->timer == 0) || (edge_input >= num_inputs_gate))
+	{
+		return (tpd->next_gate >= tpd->num_gates) ? TRUE : FALSE;
+	}
+
+	__disable_irq();
+	checkerSetFastClock(TRUE);
+
+	pin_levels = IC->enable_levels;
+	for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+	{
+		if((base_combo >> input_offset) & 0x01)
+		{
+			pin_levels |= (1UL << IC->input_pins[(gate_num*num_inputs_gate) + input_offset]);
+		}
+	}
+	checkerDriveSocket(input_field, pin_levels);
+
+	in_pin = IC->input_pins[(gate_num*num_inputs_gate) + edge_input];
+	base_level = (base_combo >> edge_input) & 0x01;
+	out_level = (IC->truth_table >> base_combo) & 0x01;
+
+	port = checkerPorts[checkerPinMap[out_pin].port_index];
+	pin_bit = checkerPinMap[out_pin].pin_bit;
+	channel_num = capture->channel - 1U;
+
+	port->AFR[pin_bit >> 3] &= ~(0xFUL << ((pin_bit & 0x07)*4));
+	port->AFR[pin_bit >> 3] |= ((uint32_t)capture->alternate << ((pin_bit & 0x07)*4));
+	port->MODER |= (GPIO_MODER_MODE0_1 << (pin_bit*2));
+
+	timer_cr1 = capture->timer->CR1;
+	(&capture->timer->CCMR1)[channel_num >> 1] |= (TIM_CCMR1_CC1S_0 << ((channel_num & 0x01)*8));
+	capture->timer->PSC = 0;
+	capture->timer->ARR = 0xFFFF;
+	capture->timer->CR1 = TIM_CR1_CEN;
+
+	first_ticks = checkerCaptureEdge(capture, in_pin, !base_level, !out_level);
+	second_ticks = checkerCaptureEdge(capture, in_pin, base_level, out_level);
+
+	capture->timer->CR1 = timer_cr1;
+	capture->timer->CNT = 0;
+	(&capture->timer->CCMR1)[channel_num >> 1] &= ~(TIM_CCMR1_CC1S_Msk << ((channel_num & 0x01)*8));
+	capture->timer->SR &= ~(TIM_SR_UIF);
+
+	port->MODER &= ~(GPIO_MODER_MODE0_Msk << (pin_bit*2));
+	port->AFR[pin_bit >> 3] &= ~(0xFUL << ((pin_bit & 0x07)*4));
+
+	if(IC->output_type == OUTPUT_OPEN_DRAIN)
+	{
+		if(out_level == 0) first_ticks = second_ticks;
+		second_ticks = first_ticks;
+	}
+
+	if((first_ticks != CHECKER_TPD_NONE) && (second_ticks != CHECKER_TPD_NONE))
+	{
+		if(second_ticks > first_ticks) first_ticks = second_ticks;
+		tpd->tpd_ns[gate_num] = (uint16_t)((first_ticks*1000UL)/TPD_CLOCK_MHZ);
+	}
+
+	checkerSetFastClock(FALSE);
+	__enable_irq();
+	return (tpd->next_gate >= tpd->num_gates) ? TRUE : FALSE;
+}
+
+/********************************************************************
+* checkerSocketPin - Finds the socket pin of a package pin
+*
+* Description:  Package pins in the first half of a package are
+* 				socket pins of the same number. Pins in the second half
+* 				are moved down so the last package pin is the last
+* 				socket pin.
+*
+* Return value:	Socket pin number
+*
+* Arguments:    uint8_t ic_pin - Package pin number
+*
+* 				uint8_t num_pins - Number of pins of the package
+********************************************************************/
+static uint8_t checkerSocketPin(uint8_t ic_pin, uint8_t num_pins)
+{
+	if(ic_pin <= (num_pins/2U)) return ic_pin;
+	return (ic_pin + (CHECKER_MAX_PINS - num_pins));
+}
+
+/********************************************************************
+* checkerSenseLow - Reads the socket with one pin driven low
+*
+* Description:  Every socket pin is set to input with a pull-up,
+* 				other than low_pin, which is driven low with no pull.
+* 				Socket pins reading low after PULL_SETTLE_CYCLES are
+* 				returned, then low_pin is set back to input with a
+* 				pull-up. Nothing is driven high, so no more than the
+* 				pull-up currents can flow into the driven pin.
+*
+* Return value:	Pin field of socket pins read low (bit n corresponds
+* 				to socket pin n)
+*
+* Arguments:    uint8_t low_pin - Socket pin to drive low
+********************************************************************/
+static PIN_FIELD_T checkerSenseLow(uint8_t low_pin)
+{
+	const PIN_MAP_T *low_map = &checkerSocketMap[low_pin];
+	uint32_t port_mask[NUM_PORTS] = {0, 0, 0};
+	uint32_t port_pull[NUM_PORTS] = {0, 0, 0};
+	uint32_t port_levels[NUM_PORTS];
+	PIN_FIELD_T low_field = 0x00000000;
+	uint8_t port_index;
+	uint8_t pin_bit;
+
+	for(uint8_t socket_pin = 1; socket_pin <= CHECKER_MAX_PINS; socket_pin++)
+	{
+		port_index = checkerSocketMap[socket_pin].port_index;
+		pin_bit = checkerSocketMap[socket_pin].pin_bit;
+
+		port_mask[port_index] |= (GPIO_MODER_MODE0_Msk << (pin_bit*2));
+		if(socket_pin != low_pin) port_pull[port_index] |= (GPIO_PUPDR_PUPD0_0 << (pin_bit*2));
+	}
+	GPIOA->MODER &= ~port_mask[PORT_A];
+	GPIOB->MODER &= ~port_mask[PORT_B];
+	GPIOC->MODER &= ~port_mask[PORT_C];
+	GPIOA->PUPDR = (GPIOA->PUPDR & ~port_mask[PORT_A]) | port_pull[PORT_A];
+	GPIOB->PUPDR = (GPIOB->PUPDR & ~port_mask[PORT_B]) | port_pull[PORT_B];
+	GPIOC->PUPDR = (GPIOC->PUPDR & ~port_mask[PORT_C]) | port_pull[PORT_C];
+	checkerPorts[low_map->port_index]->BSRR = (1UL << (low_map->pin_bit + BSRR_RESET_SHIFT));
+	checkerPorts[low_map->port_index]->MODER |= (GPIO_MODER_MODE0_0 << (low_map->pin_bit*2));
+
+	checkerWaitCycles(PULL_SETTLE_CYCLES);
+	port_levels[PORT_A] = GPIOA->IDR;
+	port_levels[PORT_B] = GPIOB->IDR;
+	port_levels[PORT_C] = GPIOC->IDR;
+	for(uint8_t socket_pin = 1; socket_pin <= CHECKER_MAX_PINS; socket_pin++)
+	{
+		if(((port_levels[checkerSocketMap[socket_pin].port_index] >> checkerSocketMap[socket_pin].pin_bit) & 0x01) == 0)
+		{
+			low_field |= CHECKER_PIN(socket_pin);
+		}
+	}
+
+	checkerPorts[low_map->port_index]->MODER &= ~(GPIO_MODER_MODE0_Msk << (low_map->pin_bit*2));
+	checkerPorts[low_map->port_index]->PUPDR |= (GPIO_PUPDR_PUPD0_0 << (low_map->pin_bit*2));
+	return low_field;
+}
+
+/********************************************************************
+* checkerCountPins - Counts the pins set in a pin field
+*
+* Description:  Clears the lowest set bit until none are left.
+*
+* Return value:	Number of pins in field
+*
+* Arguments:    PIN_FIELD_T pin_field - Pin field to count
+********************************************************************/
+static uint8_t checkerCountPins(PIN_FIELD_T pin_field)
+{
+	uint8_t num_pins = 0;
+
+	while(pin_field != 0)
+	{
+		pin_field &= (pin_field - 1U);
+		num_pins++;
+	}
+	return num_pins;
+}
+
+/********************************************************************
+* checkerScreenPins - Checks an IC's pins against a socket screen
+*
+* Description:  An IC's pins are faulty if an output pin was undriven,
+* 				an input pin was driven, or any pin was shorted. If the
+* 				IC has fewer faulty pins than the closest IC so far, it
+* 				becomes the closest IC of the screen result.
+*
+* Return value:	Pass if no pin is faulty
+*
+* Arguments:    PIN_FIELD_T input_field - Pin field of IC input pins
+*
+* 				PIN_FIELD_T output_field - Pin field of IC output pins
+*
+* 				CHECKER_SCREEN_T *screen - Screen result, updated
+********************************************************************/
+static uint8_t checkerScreenPins(PIN_FIELD_T input_field, PIN_FIELD_T output_field, CHECKER_SCREEN_T *screen)
+{
+	PIN_FIELD_T open_field = (output_field & checkerIOField & ~screen->driven_field);
+	PIN_FIELD_T stuck_field = (input_field & screen->driven_field);
+	uint8_t num_faults = checkerCountPins(open_field | stuck_field | ((input_field | output_field) & screen->short_field));
+
+	if(num_faults < screen->num_faults)
+	{
+		screen->num_faults = num_faults;
+		screen->open_field = open_field;
+		screen->stuck_field = stuck_field;
+	}
+	return (num_faults == 0) ? PASSED : FAILED;
+}
+
+/********************************************************************
+* checkerBuildVectors - Precomputes all test vectors for a group
+*
+* Description:  Selects the group's package, then configures the
+* 				socket once for the whole group, with a pull-up on the
+* 				outputs of open-drain candidates (see
+* 				checkerConfigSocket), with every input pin of the group
+* 				driven and every output pin of any candidate read, so
+* 				applying a vector only writes BSRR. Then, for every
+* 				candidate, vectors are created for each possible input
+* 				combination of a gate, in Gray code order so only one
+* 				gate input changes between consecutive combinations.
+* 				With CHECKER_PARALLEL_GATES every gate is given the
+* 				same combination in one vector, otherwise one set of
+* 				vectors is created per gate with inputs of other gates
+* 				held low. Enable pins are held at the candidate's
+* 				enable levels. Every vector drives all input pins of
+* 				the group, so it can be evaluated for any candidate.
+* 				Vectors already created for an earlier candidate are
+* 				not repeated.
+*
+* Return value:	Number of vectors built, or zero if group can not
+* 				be tested (including candidates of different packages)
+*
+* Arguments:    const IC_PARAMETERS_T *library - Array of candidate
+* 				IC parameters
+*
+* 				uint8_t library_size - Number of entries in library
+*
+* 				uint32_t group_field - Bit field of library entries
+* 				in group
+********************************************************************/
+static uint8_t checkerBuildVectors(const IC_PARAMETERS_T *library, uint8_t library_size, uint32_t group_field)
+{
+	const IC_PARAMETERS_T *IC;
+	PIN_FIELD_T input_field = 0x00000000;
+	PIN_FIELD_T output_field = 0x00000000;
+	PIN_FIELD_T pull_field = 0x00000000;
+	PIN_FIELD_T pin_levels;
+	uint8_t package = CHECKER_PACKAGE_NONE;
+	uint8_t gray_code;
+	uint8_t num_vectors = 0;
+	uint8_t num_gates;
+	uint8_t num_inputs_gate;
+	uint8_t num_groups;
+	uint16_t gate_mask;
+
+	for(uint8_t lib_index = 0; lib_index < library_size; lib_index++)
+	{
+		if(((group_field >> lib_index) & 0x01) == 0) continue;
+
+		IC = &library[lib_index];
+		if((package != CHECKER_PACKAGE_NONE) && (IC->package != package)) return 0;
+
+		package = IC->package;
+		input_field = IC->input_field;
+		output_field |= IC->output_field;
+		if(IC->output_type == OUTPUT_OPEN_DRAIN) pull_field |= IC->output_field;
+	}
+
+	if(CheckerSelectPackage(package) == FAILED) return 0;
+	if((input_field | output_field) & ~checkerIOField) return 0;
+	checkerConfigSocket(input_field, output_field);
+	checkerPullSocket(pull_field, pull_field);
+
+	for(uint8_t lib_index = 0; lib_index < library_size; lib_index++)
+	{
+		if(((group_field >> lib_index) & 0x01) == 0) continue;
+
+		IC = &library[lib_index];
+		num_gates = IC->num_outputs;
+		num_inputs_gate = IC->num_inputs/IC->num_outputs;
+		num_groups = (CHECKER_PARALLEL_GATES == TRUE) ? 1U : num_gates;
+
+		for(uint8_t group_num = 0; group_num < num_groups; group_num++)
+		{
+			gate_mask = (CHECKER_PARALLEL_GATES == TRUE) ? ((1U << num_gates) - 1U) : (1U << group_num);
+
+			for(uint8_t combo = 0; combo < (1U << num_inputs_gate); combo++)
+			{
+				gray_code = combo ^ (combo >> 1);
+				pin_levels = IC->enable_levels;
+				for(uint8_t gate_num = 0; gate_num < num_gates; gate_num++)
+				{
+					if(((gate_mask >> gate_num) & 0x01) == 0) continue;
+
+					for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+					{
+						if((gray_code >> input_offset) & 0x01)
+						{
+							pin_levels |= (1UL << IC->input_pins[(gate_num*num_inputs_gate) + input_offset]);
+						}
+					}
+				}
+
+				num_vectors = checkerAddVector(pin_levels, input_field, num_vectors);
+				if(num_vectors == 0) return 0;
+			}
+		}
+	}
+	return num_vectors;
+}
+
+/********************************************************************
+* checkerAddVector - Adds a vector to the group's vector list
+*
+* Description:  Searches the vectors built so far for the same pin
+* 				levels, in which case nothing is added. Otherwise a new
+* 				vector is appended. Vectors are applied in list order,
+* 				so its BSRR words only hold the set or reset bit of input
+* 				pins that differ from the previous vector (every input
+* 				pin for the first vector). The settle delay is chosen by
+* 				the direction of the changed pins: CYCLES_DELAY_RISE if
+* 				all rose, CYCLES_DELAY_FALL if all fell, otherwise
+* 				CYCLES_DELAY.
+*
+* Return value:	New number of vectors, or zero if vector list is full
+*
+* Arguments:    PIN_FIELD_T pin_levels - Pin field of input levels
+*
+* 				PIN_FIELD_T input_field - Pin field of all input pins
+*
+* 				uint8_t num_vectors - Number of vectors built so far
+********************************************************************/
+static uint8_t checkerAddVector(PIN_FIELD_T pin_levels, PIN_FIELD_T input_field, uint8_t num_vectors)
+{
+	PIN_FIELD_T changed_field = input_field;
+	uint8_t port_index;
+	uint8_t pin_bit;
+
+	for(uint8_t vector_num = 0; vector_num < num_vectors; vector_num++)
+	{
+		if(checkerVectorLevels[vector_num] == pin_levels) return num_vectors;
+	}
+
+	if(num_vectors >= CHECKER_MAX_VECTORS) return 0;
+
+	checkerVectorBsrr[PORT_A][num_vectors] = 0;
+	checkerVectorBsrr[PORT_B][num_vectors] = 0;
+	checkerVectorBsrr[PORT_C][num_vectors] = 0;
+	checkerVectorLevels[num_vectors] = pin_levels;
+	checkerVectorSettle[num_vectors] = CYCLES_DELAY;
+
+	if(num_vectors > 0)
+	{
+		changed_field &= (pin_levels ^ checkerVectorLevels[num_vectors - 1U]);
+		if((changed_field & ~pin_levels) == 0)
+		{
+			checkerVectorSettle[num_vectors] = CYCLES_DELAY_RISE;
+		} else if((changed_field & pin_levels) == 0)
+		{
+			checkerVectorSettle[num_vectors] = CYCLES_DELAY_FALL;
+		}
+	}
+
+	for(uint8_t ic_pin = 1; ic_pin <= checkerNumPins; ic_pin++)
+	{
+		if(PIN_LEVEL(changed_field, ic_pin) == 0) continue;
+
+		port_index = checkerPinMap[ic_pin].port_index;
+		pin_bit = checkerPinMap[ic_pin].pin_bit;
+
+		if(PIN_LEVEL(pin_levels, ic_pin))
+		{
+			checkerVectorBsrr[port_index][num_vectors] |= (1UL << pin_bit);
+		} else
+		{
+			checkerVectorBsrr[port_index][num_vectors] |= (1UL << (pin_bit + BSRR_RESET_SHIFT));
+		}
+	}
+	return (num_vectors + 1U);
+}
+
+/********************************************************************
+* checkerApplyVector - Drives a precomputed vector onto the IC inputs
+*
+* Description:  Writes the precomputed BSRR word of each port. BSRR
+* 				writes are atomic and only affect pins with a set or
+* 				reset bit given, so a whole vector is applied with a
+* 				single store per port and no read-modify-write.
+*
+* Return value:	None
+*
+* Arguments:    uint8_t vector_num - Index of vector to be applied
+********************************************************************/
+static void checkerApplyVector(uint8_t vector_num)
+{
+	GPIOA->BSRR = checkerVectorBsrr[PORT_A][vector_num];
+	GPIOB->BSRR = checkerVectorBsrr[PORT_B][vector_num];
+	GPIOC->BSRR = checkerVectorBsrr[PORT_C][vector_num];
+}
+
+/********************************************************************
+* checkerPlayVectors - Applies and reads a run of vectors by DMA
+*
+* Description:  TIM2 paces five DMA1 channels through the vector list,
+* 				from first_vector on.
+* 				Each TIM2 period, the update event writes the port A
+* 				BSRR word of the next vector (channel 2), and compare
+* 				events 1 and 2 write ports B and C (channels 5 and 3)
+* 				one tick apart. Compare events 3 and 4 then copy the
+* 				port A and B input data registers into the response
+* 				buffers (channels 1 and 4) after the longest settle
+* 				delay of the run, so every vector gets the same exact
+* 				settle time with no CPU jitter. The first vector is
+* 				started by a software update event. TIM2 runs from the
+* 				same clock as TIM22, so settle delays keep their
+* 				meaning. Returns once both read channels complete, with
+* 				TIM2 and the channels stopped.
+*
+* Return value:	None
+*
+* Arguments:    uint8_t first_vector - Index of first vector to play
+*
+* 				uint8_t num_vectors - Number of vectors to play
+********************************************************************/
+static void checkerPlayVectors(uint8_t first_vector, uint8_t num_vectors)
+{
+	uint8_t settle_cycles = 0;
+
+	for(uint8_t vector_num = first_vector; vector_num < (first_vector + num_vectors); vector_num++)
+	{
+		if(checkerVectorSettle[vector_num] > settle_cycles)
+		{
+			settle_cycles = checkerVectorSettle[vector_num];
+		}
+	}
+
+	TIM2->CR1 = 0;
+	TIM2->DIER = 0;
+	TIM2->CCMR1 = 0;
+	TIM2->CCMR2 = 0;
+	TIM2->CCER = 0;
+	TIM2->PSC = 0;
+	TIM2->CCR1 = DMA_WRITE_TICKS - 1U;
+	TIM2->CCR2 = DMA_WRITE_TICKS;
+	TIM2->CCR3 = DMA_WRITE_TICKS + settle_cycles;
+	TIM2->CCR4 = DMA_WRITE_TICKS + settle_cycles;
+	TIM2->ARR = DMA_WRITE_TICKS + settle_cycles + DMA_READ_TICKS;
+
+	DMA1_CSELR->CSELR &= ~(DMA_CSELR_C1S_Msk | DMA_CSELR_C2S_Msk | DMA_CSELR_C3S_Msk | DMA_CSELR_C4S_Msk | DMA_CSELR_C5S_Msk);
+	DMA1_CSELR->CSELR |= ((DMA_REQ_TIM2 << DMA_CSELR_C1S_Pos) | (DMA_REQ_TIM2 << DMA_CSELR_C2S_Pos) |
+						  (DMA_REQ_TIM2 << DMA_CSELR_C3S_Pos) | (DMA_REQ_TIM2 << DMA_CSELR_C4S_Pos) |
+						  (DMA_REQ_TIM2 << DMA_CSELR_C5S_Pos));
+	DMA1->IFCR = (DMA_IFCR_CGIF1 | DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3 | DMA_IFCR_CGIF4 | DMA_IFCR_CGIF5);
+
+	DMA1_Channel2->CPAR = (uint32_t)&GPIOA->BSRR;
+	DMA1_Channel2->CMAR = (uint32_t)&checkerVectorBsrr[PORT_A][first_vector];
+	DMA1_Channel5->CPAR = (uint32_t)&GPIOB->BSRR;
+	DMA1_Channel5->CMAR = (uint32_t)&checkerVectorBsrr[PORT_B][first_vector];
+	DMA1_Channel3->CPAR = (uint32_t)&GPIOC->BSRR;
+	DMA1_Channel3->CMAR = (uint32_t)&checkerVectorBsrr[PORT_C][first_vector];
+	DMA1_Channel1->CPAR = (uint32_t)&GPIOA->IDR;
+	DMA1_Channel1->CMAR = (uint32_t)&checkerResponses[PORT_A][first_vector];
+	DMA1_Channel4->CPAR = (uint32_t)&GPIOB->IDR;
+	DMA1_Channel4->CMAR = (uint32_t)&checkerResponses[PORT_B][first_vector];
+
+	DMA1_Channel2->CNDTR = num_vectors;
+	DMA1_Channel5->CNDTR = num_vectors;
+	DMA1_Channel3->CNDTR = num_vectors;
+	DMA1_Channel1->CNDTR = num_vectors;
+	DMA1_Channel4->CNDTR = num_vectors;
+
+	DMA1_Channel2->CCR = (DMA_CCR_MSIZE_1 | DMA_CCR_PSIZE_1 | DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_EN);
+	DMA1_Channel5->CCR = (DMA_CCR_MSIZE_1 | DMA_CCR_PSIZE_1 | DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_EN);
+	DMA1_Channel3->CCR = (DMA_CCR_MSIZE_1 | DMA_CCR_PSIZE_1 | DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_EN);
+	DMA1_Channel1->CCR = (DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_MINC | DMA_CCR_EN);
+	DMA1_Channel4->CCR = (DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_MINC | DMA_CCR_EN);
+
+	TIM2->DIER = (TIM_DIER_UDE | TIM_DIER_CC1DE | TIM_DIER_CC2DE | TIM_DIER_CC3DE | TIM_DIER_CC4DE);
+	TIM2->EGR = TIM_EGR_UG;
+	TIM2->CR1 = TIM_CR1_CEN;
+
+	while((DMA1->ISR & (DMA_ISR_TCIF1 | DMA_ISR_TCIF4)) != (DMA_ISR_TCIF1 | DMA_ISR_TCIF4)){}
+
+	TIM2->CR1 = 0;
+	TIM2->DIER = 0;
+	TIM2->SR = 0;
+	DMA1_Channel1->CCR = 0;
+	DMA1_Channel2->CCR = 0;
+	DMA1_Channel3->CCR = 0;
+	DMA1_Channel4->CCR = 0;
+	DMA1_Channel5->CCR = 0;
+	DMA1->IFCR = (DMA_IFCR_CGIF1 | DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3 | DMA_IFCR_CGIF4 | DMA_IFCR_CGIF5);
+}
+
+/********************************************************************
+* checkerStartVectors - Plays back vectors by DMA when possible
+*
+* Description:  With CHECKER_DMA_PLAYBACK, and when no output of the
+* 				group is on port C (which has no read channel), the
+* 				vectors are played back at once by checkerPlayVectors.
+* 				Otherwise vectors are left for the CPU to apply one at
+* 				a time in checkerVectorResponse.
+*
+* Return value:	TRUE if vectors were played back by DMA
+*
+* Arguments:    uint8_t first_vector - Index of first vector to play
+*
+* 				uint8_t num_vectors - Number of vectors to play
+********************************************************************/
+static uint8_t checkerStartVectors(uint8_t first_vector, uint8_t num_vectors)
+{
+	if((CHECKER_DMA_PLAYBACK == TRUE) && (checkerReadMasks[PORT_C] == 0))
+	{
+		checkerPlayVectors(first_vector, num_vectors);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+/********************************************************************
+* checkerVectorResponse - Gives the output reading of a vector
+*
+* Description:  After DMA playback, the reading is taken from the
+* 				captured port A and B input registers. Otherwise the
+* 				vector is applied and the outputs are read now, so
+* 				vectors must be given in order.
+*
+* Return value:	Pin field of read outputs
+*
+* Arguments:    uint8_t vector_num - Index of vector
+*
+* 				uint8_t dma_playback - Result of checkerStartVectors
+********************************************************************/
+static PIN_FIELD_T checkerVectorResponse(uint8_t vector_num, uint8_t dma_playback)
+{
+	uint32_t port_idr[NUM_PORTS] = {0, 0, 0};
+
+	if(dma_playback == TRUE)
+	{
+		port_idr[PORT_A] = checkerResponses[PORT_A][vector_num];
+		port_idr[PORT_B] = checkerResponses[PORT_B][vector_num];
+		return checkerOutputLevels(port_idr);
+	}
+
+	checkerApplyVector(vector_num);
+	return checkerReadOutputs(checkerVectorSettle[vector_num]);
+}
+
+/********************************************************************
+* checkerConfigSocket - Sets the direction of every socket pin
+*
+* Description:  Pins in drive_field are set to output mode and pins
+* 				in read_field to input mode (relative to MCU), with
+* 				the port and bit of each read pin, and the IDR bits
+* 				read on each port, saved for checkerReadOutputs. Mode
+* 				bits are gathered per port so each MODER is written
+* 				once. Nothing is written if the socket is already
+* 				configured for the same fields.
+*
+* Return value:	None
+*
+* Arguments:    PIN_FIELD_T drive_field - Pin field of pins to drive
+*
+* 				PIN_FIELD_T read_field - Pin field of pins to read
+********************************************************************/
+static void checkerConfigSocket(PIN_FIELD_T drive_field, PIN_FIELD_T read_field)
+{
+	uint32_t port_mask[NUM_PORTS] = {0, 0, 0};
+	uint32_t port_mode[NUM_PORTS] = {0, 0, 0};
+	uint8_t port_index;
+	uint8_t pin_bit;
+
+	if((drive_field == checkerDriveField) && (read_field == checkerReadField)) return;
+	checkerDriveField = drive_field;
+	checkerReadField = read_field;
+
+	checkerNumOutputs = 0;
+	checkerReadMasks[PORT_A] = 0;
+	checkerReadMasks[PORT_B] = 0;
+	checkerReadMasks[PORT_C] = 0;
+	for(uint8_t ic_pin = 1; ic_pin <= checkerNumPins; ic_pin++)
+	{
+		if(PIN_LEVEL(drive_field | read_field, ic_pin) == 0) continue;
+
+		port_index = checkerPinMap[ic_pin].port_index;
+		pin_bit = checkerPinMap[ic_pin].pin_bit;
+		if(port_index == PORT_NONE) continue;
+
+		port_mask[port_index] |= (GPIO_MODER_MODE0_Msk << (pin_bit*2));
+
+		if(PIN_LEVEL(drive_field, ic_pin))
+		{
+			port_mode[port_index] |= (GPIO_MODER_MODE0_0 << (pin_bit*2));
+		} else
+		{
+			checkerOutputs[checkerNumOutputs].ic_pin = ic_pin;
+			checkerOutputs[checkerNumOutputs].port_index = port_index;
+			checkerOutputs[checkerNumOutputs].pin_bit = pin_bit;
+			checkerNumOutputs++;
+			checkerReadMasks[port_index] |= (1UL << pin_bit);
+		}
+	}
+
+	GPIOA->MODER = (GPIOA->MODER & ~port_mask[PORT_A]) | port_mode[PORT_A];
+	GPIOB->MODER = (GPIOB->MODER & ~port_mask[PORT_B]) | port_mode[PORT_B];
+	GPIOC->MODER = (GPIOC->MODER & ~port_mask[PORT_C]) | port_mode[PORT_C];
+}
+
+/********************************************************************
+* checkerDriveSocket - Configures and drives the whole socket
+*
+* Description:  Pins in drive_field are driven to their level from
+* 				level_field and every other IO pin of the package is
+* 				read. Levels are gathered into one BSRR word per port
+* 				and written before checkerConfigSocket switches any pin
+* 				to output mode, so no pin glitches.
+*
+* Return value:	None
+*
+* Arguments:    PIN_FIELD_T drive_field - Pin field of pins to drive
+*
+* 				PIN_FIELD_T level_field - Pin field of driven levels
+********************************************************************/
+static void checkerDriveSocket(PIN_FIELD_T drive_field, PIN_FIELD_T level_field)
+{
+	uint32_t port_bsrr[NUM_PORTS] = {0, 0, 0};
+	uint8_t port_index;
+	uint8_t pin_bit;
+
+	for(uint8_t ic_pin = 1; ic_pin <= checkerNumPins; ic_pin++)
+	{
+		if(PIN_LEVEL(drive_field & checkerIOField, ic_pin) == 0) continue;
+
+		port_index = checkerPinMap[ic_pin].port_index;
+		pin_bit = checkerPinMap[ic_pin].pin_bit;
+		if(PIN_LEVEL(level_field, ic_pin))
+		{
+			port_bsrr[port_index] |= (1UL << pin_bit);
+		} else
+		{
+			port_bsrr[port_index] |= (1UL << (pin_bit + BSRR_RESET_SHIFT));
+		}
+	}
+
+	GPIOA->BSRR = port_bsrr[PORT_A];
+	GPIOB->BSRR = port_bsrr[PORT_B];
+	GPIOC->BSRR = port_bsrr[PORT_C];
+	checkerConfigSocket(drive_field & checkerIOField, checkerIOField & ~drive_field);
+}
+
+/********************************************************************
+* checkerPullSocket - Sets the pull resistor of every socket pin
+*
+* Description:  Pins in pull_field are given a pull-up if also in
+* 				up_field, and a pull-down otherwise. Every other IO pin
+* 				of the package has no pull. Pull bits are gathered per
+* 				port so each PUPDR is written once.
+*
+* Return value:	None
+*
+* Arguments:    PIN_FIELD_T pull_field - Pin field of pins to pull
+*
+* 				PIN_FIELD_T up_field - Pin field of pins to pull up
+********************************************************************/
+static void checkerPullSocket(PIN_FIELD_T pull_field, PIN_FIELD_T up_field)
+{
+	uint32_t port_mask[NUM_PORTS] = {0, 0, 0};
+	uint32_t port_pull[NUM_PORTS] = {0, 0, 0};
+	uint8_t port_index;
+	uint8_t pin_bit;
+
+	for(uint8_t ic_pin = 1; ic_pin <= checkerNumPins; ic_pin++)
+	{
+		if(PIN_LEVEL(checkerIOField, ic_pin) == 0) continue;
+
+		port_index = checkerPinMap[ic_pin].port_index;
+		pin_bit = checkerPinMap[ic_pin].pin_bit;
+
+		port_mask[port_index] |= (GPIO_PUPDR_PUPD0_Msk << (pin_bit*2));
+
+		if(PIN_LEVEL(pull_field & up_field, ic_pin))
+		{
+			port_pull[port_index] |= (GPIO_PUPDR_PUPD0_0 << (pin_bit*2));
+		} else if(PIN_LEVEL(pull_field, ic_pin))
+		{
+			port_pull[port_index] |= (GPIO_PUPDR_PUPD0_1 << (pin_bit*2));
+		}
+	}
+
+	GPIOA->PUPDR = (GPIOA->PUPDR & ~port_mask[PORT_A]) | port_pull[PORT_A];
+	GPIOB->PUPDR = (GPIOB->PUPDR & ~port_mask[PORT_B]) | port_pull[PORT_B];
+	GPIOC->PUPDR = (GPIOC->PUPDR & ~port_mask[PORT_C]) | port_pull[PORT_C];
+}
+
+/********************************************************************
+* checkerReadOutputs - Reads all socket outputs of the current group
+*
+* Description:  TIM22 is loaded with the given delay and enabled as a
+* 				timeout. The read pins of every port are then sampled
+* 				until CHECKER_STABLE_SAMPLES samples in a row agree, so
+* 				fast ICs are read as soon as their outputs settle. If the
+* 				timeout is reached first, the ports are sampled once more
+* 				and that sample is used, matching a fixed delay read. The
+* 				flag is cleared first, as one pulse mode leaves it set
+* 				after each delay, and the timer is stopped and cleared on
+* 				an early exit. All outputs come from one sample of the
+* 				input data registers, converted by checkerOutputLevels.
+* 				Samples taken are added to the settle statistics.
+*
+* Return value:	Pin field of read output levels
+*
+* Arguments:    uint8_t settle_cycles - TIM22 cycles to wait at most
+* 				before reading
+********************************************************************/
+static PIN_FIELD_T checkerReadOutputs(uint8_t settle_cycles)
+{
+	uint32_t port_idr[NUM_PORTS];
+	uint32_t last_idr[NUM_PORTS];
+	uint8_t num_samples = 1;
+	uint8_t num_stable = 1;
+
+	TIM22->ARR = settle_cycles;
+	TIM22->SR &= ~(TIM_SR_UIF);
+	TIM22->CR1 |= TIM_CR1_CEN;
+
+	last_idr[PORT_A] = GPIOA->IDR & checkerReadMasks[PORT_A];
+	last_idr[PORT_B] = GPIOB->IDR & checkerReadMasks[PORT_B];
+	last_idr[PORT_C] = GPIOC->IDR & checkerReadMasks[PORT_C];
+
+	while(num_stable < CHECKER_STABLE_SAMPLES)
+	{
+		if(TIM22->SR & TIM_SR_UIF_Msk)
+		{
+			checkerSettleStats.num_timeouts++;
+			break;
+		}
+
+		port_idr[PORT_A] = GPIOA->IDR & checkerReadMasks[PORT_A];
+		port_idr[PORT_B] = GPIOB->IDR & checkerReadMasks[PORT_B];
+		port_idr[PORT_C] = GPIOC->IDR & checkerReadMasks[PORT_C];
+		num_samples++;
+
+		if((port_idr[PORT_A] == last_idr[PORT_A]) &&
+		   (port_idr[PORT_B] == last_idr[PORT_B]) &&
+		   (port_idr[PORT_C] == last_idr[PORT_C]))
+		{
+			num_stable++;
+		} else
+		{
+			num_stable = 1;
+			last_idr[PORT_A] = port_idr[PORT_A];
+			last_idr[PORT_B] = port_idr[PORT_B];
+			last_idr[PORT_C] = port_idr[PORT_C];
+		}
+	}
+
+	if(num_stable < CHECKER_STABLE_SAMPLES)
+	{
+		last_idr[PORT_A] = GPIOA->IDR;
+		last_idr[PORT_B] = GPIOB->IDR;
+		last_idr[PORT_C] = GPIOC->IDR;
+		num_samples++;
+	} else
+	{
+		TIM22->CR1 &= ~(TIM_CR1_CEN);
+		TIM22->CNT = 0;
+	}
+
+	checkerSettleStats.num_reads++;
+	checkerSettleStats.num_samples += num_samples;
+	checkerSettleStats.last_samples = num_samples;
+	if(num_samples > checkerSettleStats.max_samples)
+	{
+		checkerSettleStats.max_samples = num_samples;
+	}
+
+	return checkerOutputLevels(last_idr);
+}
+
+/********************************************************************
+* checkerWaitCycles - Waits out a TIM22 one pulse delay
+*
+* Description:  TIM22 is loaded with the delay and enabled, and the
+* 				update flag is polled until the pulse ends. One pulse
+* 				mode stops the timer and clears the counter itself.
+*
+* Return value:	None
+*
+* Arguments:    uint8_t delay_cycles - TIM22 cycles to wait
+********************************************************************/
+static void checkerWaitCycles(uint8_t delay_cycles)
+{
+	TIM22->ARR = delay_cycles;
+	TIM22->SR &= ~(TIM_SR_UIF);
+	TIM22->CR1 |= TIM_CR1_CEN;
+
+	while((TIM22->SR & TIM_SR_UIF_Msk) == 0){}
+}
+
+/********************************************************************
+* checkerReadSettled - Reads outputs after an exact settle delay
+*
+* Description:  Waits out the TIM22 one pulse delay (see
+* 				checkerWaitCycles), then reads every port once. Unlike
+* 				checkerReadOutputs, the reading is not taken early once
+* 				outputs are stable, so outputs that are still changing
+* 				are read as they are.
+*
+* Return value:	Pin field of read output levels
+*
+* Arguments:    uint8_t settle_cycles - TIM22 cycles to wait before
+* 				reading
+********************************************************************/
+static PIN_FIELD_T checkerReadSettled(uint8_t settle_cycles)
+{
+	uint32_t port_idr[NUM_PORTS];
+
+	checkerWaitCycles(settle_cycles);
+
+	port_idr[PORT_A] = GPIOA->IDR;
+	port_idr[PORT_B] = GPIOB->IDR;
+	port_idr[PORT_C] = GPIOC->IDR;
+	return checkerOutputLevels(port_idr);
+}
+
+/********************************************************************
+* checkerReadDrive - Classifies outputs as driving high, low, or Hi-Z
+*
+* Description:  Outputs are read once with their pull-down and once
+* 				with their pull-up enabled. An output reading high
+* 				against the pull-down drives high, one reading low
+* 				against the pull-up drives low, and one following both
+* 				pulls is Hi-Z. Each read ends as soon as the outputs are
+* 				stable (see checkerReadOutputs), so both take only a few
+* 				cycles. Pulls are removed afterwards.
+*
+* Return value:	None
+*
+* Arguments:    PIN_FIELD_T output_field - Pin field of outputs to
+* 				classify, all read pins of the socket configuration
+*
+* 				DRIVE_STATE_T *drive - Classification to fill
+********************************************************************/
+static void checkerReadDrive(PIN_FIELD_T output_field, DRIVE_STATE_T *drive)
+{
+	checkerPullSocket(output_field, 0x00000000);
+	drive->high_field = (checkerReadOutputs(PULL_SETTLE_CYCLES) & output_field);
+	checkerPullSocket(output_field, output_field);
+	drive->low_field = (~checkerReadOutputs(PULL_SETTLE_CYCLES) & output_field);
+	checkerPullSocket(0x00000000, 0x00000000);
+}
+
+/********************************************************************
+* checkerOutputLevels - Converts port input data to a pin field
+*
+* Description:  The level of each output pin of the current group is
+* 				taken from the input data register value of its port
+* 				and placed into a pin field.
+*
+* Return value:	Pin field of read output levels
+*
+* Arguments:    const uint32_t *port_idr - Input data register value
+* 				of each port
+********************************************************************/
+static PIN_FIELD_T checkerOutputLevels(const uint32_t *port_idr)
+{
+	PIN_FIELD_T read_levels = 0x00000000;
+	const PIN_LOCATION_T *output;
+
+	for(uint8_t output_num = 0; output_num < checkerNumOutputs; output_num++)
+	{
+		output = &checkerOutputs[output_num];
+		read_levels |= (((port_idr[output->port_index] >> output->pin_bit) & 0x01) << output->ic_pin);
+	}
+	return read_levels;
+}
+
+/********************************************************************
+* checkerBuildExpect - Finds the expected outputs of every vector
+*
+* Description:  For every vector of the list, each gate's expected
+* 				output is taken from the truth table at the gate's
+* 				input index (see checkerGateIndex), and placed into the
+* 				vector's expected output levels.
+*
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *IC - IC the vectors were built
+* 				for
+*
+* 				uint8_t num_vectors - Number of vectors built
+********************************************************************/
+static void checkerBuildExpect(const IC_PARAMETERS_T *IC, uint8_t num_vectors)
+{
+	uint8_t num_inputs_gate = IC->num_inputs/IC->num_outputs;
+	PIN_FIELD_T expect_levels;
+	uint8_t tt_index;
+	const uint8_t *gate_pins;
+
+	for(uint8_t vector_num = 0; vector_num < num_vectors; vector_num++)
+	{
+		expect_levels = 0x00000000;
+		gate_pins = IC->input_pins;
+
+		for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+		{
+			tt_index = checkerGateIndex(gate_pins, num_inputs_gate, checkerVectorLevels[vector_num]);
+			expect_levels |= ((PIN_FIELD_T)((IC->truth_table >> tt_index) & 0x01) << IC->output_pins[gate_num]);
+			gate_pins += num_inputs_gate;
+		}
+		checkerExpectLevels[vector_num] = expect_levels;
+	}
+}
+
+/********************************************************************
+* checkerGateIndex - Finds the truth table index of a gate's inputs
+*
+* Description:  The gate input levels are taken from the applied
+* 				vector and packed with input A as bit 0.
+*
+* Return value:	Truth table index
+*
+* Arguments:    const uint8_t *gate_pins - Package pins of gate inputs
+*
+* 				uint8_t num_inputs_gate - Number of gate inputs
+*
+* 				PIN_FIELD_T pin_levels - Pin field of applied inputs
+********************************************************************/
+static uint8_t checkerGateIndex(const uint8_t *gate_pins, uint8_t num_inputs_gate, PIN_FIELD_T pin_levels)
+{
+	uint8_t tt_index = 0;
+
+	for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+	{
+		tt_index |= (PIN_LEVEL(pin_levels, gate_pins[input_offset]) << input_offset);
+	}
+	return tt_index;
+}
+
+/********************************************************************
+* checkerTestBlock - Checks one candidate against a block of readings
+*
+* Description:  Bit-sliced form of the truth table check, where every
+* 				pin word holds a pin's level over a block of vectors.
+* 				The candidate's expected output words for the block are
+* 				generated ahead (see IC_PARAMETERS_T), so each gate
+* 				takes one XOR with its output word, and mismatches are
+* 				gathered over all gates. Only vectors in the block's
+* 				care word count, as vectors that do not hold the
+* 				candidate's enable pins at its enable levels were built
+* 				for another candidate.
+*
+* Return value:	Pass or failure of candidate for this block
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Candidate IC parameters
+*
+* 				const uint32_t *pin_words - Level words indexed by
+* 				package pin, bit n for vector n of the block
+*
+* 				uint8_t block_num - Index of block, counted in
+* 				CHECKER_STEP_VECTORS vectors
+********************************************************************/
+static uint8_t checkerTestBlock(const IC_PARAMETERS_T *IC, const uint32_t *pin_words, uint8_t block_num)
+{
+	const uint32_t *expect_words = &IC->expect_words[block_num*(IC->num_outputs + 1U)];
+	uint32_t mismatch_word = 0;
+
+	for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+	{
+		mismatch_word |= (expect_words[gate_num + 1U] ^ pin_words[IC->output_pins[gate_num]]);
+	}
+	return ((mismatch_word & expect_words[0]) == 0) ? PASSED : FAILED;
+}
+
+/********************************************************************
+* checkerNextDrive - Moves a group's cursor to its next live candidate
+*
+* Description:  Candidates are only ever cleared from the live field,
+* 				so those skipped here are never needed again.
+*
+* Return value:	None
+*
+* Arguments:    CHECKER_GROUP_T *group - Group test cursor, updated
+********************************************************************/
+static void checkerNextDrive(CHECKER_GROUP_T *group)
+{
+	while((group->next_drive < group->library_size) &&
+		  (((group->live_field >> group->next_drive) & 0x01) == 0))
+	{
+		group->next_drive++;
+	}
+}
+
+/********************************************************************
+* checkerTestDrive - Checks the output stage of a candidate
+*
+* Description:  Every gate is driven to the first input combination
+* 				with a low truth table output, then to the first with a
+* 				high output, with the enable pins at their enable
+* 				levels, and the outputs are classified each time by
+* 				checkerReadDrive. Low outputs must drive low. High
+* 				outputs must drive high, or be Hi-Z for an open-drain
+* 				IC, which tells apart ICs with the same logic but a
+* 				different output stage (e.g. 74HC00 and 74HC03). A
+* 				tri-state IC then has its enable pins set away from
+* 				their enable levels, and every output must be Hi-Z.
+*
+* Return value:	Pass or failure of candidate's output stage
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Candidate IC parameters
+********************************************************************/
+static uint8_t checkerTestDrive(const IC_PARAMETERS_T *IC)
+{
+	PIN_FIELD_T input_field = IC->input_field;
+	PIN_FIELD_T output_field = IC->output_field;
+	PIN_FIELD_T pin_levels;
+	PIN_FIELD_T high_field;
+	DRIVE_STATE_T drive;
+	uint8_t num_inputs_gate = IC->num_inputs/IC->num_outputs;
+	uint8_t combo;
+
+	for(uint8_t out_level = 0; out_level < 2U; out_level++)
+	{
+		for(combo = 0; combo < (1U << num_inputs_gate); combo++)
+		{
+			if(((IC->truth_table >> combo) & 0x01) == out_level) break;
+		}
+		if(combo == (1U << num_inputs_gate)) continue;
+
+		pin_levels = IC->enable_levels;
+		for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+		{
+			for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+			{
+				if((combo >> input_offset) & 0x01)
+				{
+					pin_levels |= (1UL << IC->input_pins[(gate_num*num_inputs_gate) + input_offset]);
+				}
+			}
+		}
+		checkerDriveSocket(input_field, pin_levels);
+		checkerReadDrive(output_field, &drive);
+
+		high_field = ((out_level != 0) && (IC->output_type != OUTPUT_OPEN_DRAIN)) ? output_field : 0x00000000;
+		if((drive.high_field != high_field) || (drive.low_field != ((out_level == 0) ? output_field : 0x00000000)))
+		{
+			return FAILED;
+		}
+	}
+
+	if(IC->output_type == OUTPUT_TRI_STATE)
+	{
+		checkerDriveSocket(input_field, IC->enable_levels ^ IC->enable_field);
+		checkerReadDrive(output_field, &drive);
+		if((drive.high_field | drive.low_field) != 0) return FAILED;
+	}
+	return PASSED;
+}
+
+/********************************************************************
+* checkerSetFastClock - Switches system clock for delay measurement
+*
+* Description:  When enabled, HSI16 is started, one flash wait state
+* 				is set (required above 8 MHz in voltage range 2), and
+* 				the system clock is switched from MSI to HSI16. This
+* 				gives a timer resolution of 62.5 ns instead of 477 ns.
+* 				When disabled, the system clock is switched back to
+* 				MSI, the wait state removed and HSI16 stopped. SysTick
+* 				also runs from the system clock, so the current time
+* 				slice ends early while the fast clock is used.
+*
+* Return value:	None
+*
+* Arguments:    uint8_t enable - TRUE to switch to HSI16, FALSE to
+* 				switch back to MSI
+********************************************************************/
+static void checkerSetFastClock(uint8_t enable)
+{
+	if(enable == TRUE)
+	{
+		RCC->CR |= RCC_CR_HSION;
+		while((RCC->CR & RCC_CR_HSIRDY) == 0){}
+
+		FLASH->ACR |= FLASH_ACR_LATENCY;
+		while((FLASH->ACR & FLASH_ACR_LATENCY) == 0){}
+
+		RCC->CFGR = ((RCC->CFGR & ~RCC_CFGR_SW) | RCC_CFGR_SW_HSI);
+		while((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_HSI){}
+	} else
+	{
+		RCC->CFGR = ((RCC->CFGR & ~RCC_CFGR_SW) | RCC_CFGR_SW_MSI);
+		while((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_MSI){}
+
+		FLASH->ACR &= ~(FLASH_ACR_LATENCY);
+		RCC->CR &= ~(RCC_CR_HSION);
+	}
+}
+
+/********************************************************************
+* checkerCaptureEdge - Times one gate output edge
+*
+* Description:  Waits TPD_SETTLE_TICKS for the socket to settle, then
+* 				arms the capture channel for the expected output edge
+* 				direction. The counter is read and the input pin is
+* 				changed to in_level with a single BSRR write. The
+* 				capture flag is polled until the output edge is
+* 				captured or TPD_TIMEOUT_TICKS pass. The captured count
+* 				minus the start count, less TPD_LATENCY_TICKS, is the
+* 				propagation delay. The capture timer must already be
+* 				running with its channel mapped to the output pin.
+*
+* Return value:	Propagation delay in timer ticks, or CHECKER_TPD_NONE
+* 				if no edge was captured
+*
+* Arguments:    const CAPTURE_MAP_T *capture - Capture channel of
+* 				output pin
+*
+* 				uint8_t in_pin - Package pin of gate input to change
+*
+* 				uint8_t in_level - New level of gate input
+*
+* 				uint8_t out_level - Expected new level of gate output
+********************************************************************/
+static uint16_t checkerCaptureEdge(const CAPTURE_MAP_T *capture, uint8_t in_pin, uint8_t in_level, uint8_t out_level)
+{
+	TIM_TypeDef *timer = capture->timer;
+	uint8_t channel_num = capture->channel - 1U;
+	uint8_t pin_bit = checkerPinMap[in_pin].pin_bit;
+	GPIO_TypeDef *port = checkerPorts[checkerPinMap[in_pin].port_index];
+	uint32_t edge_bsrr = (in_level) ? (1UL << pin_bit) : (1UL << (pin_bit + BSRR_RESET_SHIFT));
+	uint16_t start_count = (uint16_t)timer->CNT;
+	uint16_t tpd_ticks = CHECKER_TPD_NONE;
+
+	while((uint16_t)(timer->CNT - start_count) < TPD_SETTLE_TICKS){}
+
+	timer->CCER &= ~((TIM_CCER_CC1E | TIM_CCER_CC1P) << (channel_num*4));
+	if(out_level == 0)
+	{
+		timer->CCER |= (TIM_CCER_CC1P << (channel_num*4));
+	}
+	timer->CCER |= (TIM_CCER_CC1E << (channel_num*4));
+	timer->SR &= ~(TIM_SR_CC1IF << channel_num);
+
+	start_count = (uint16_t)timer->CNT;
+	port->BSRR = edge_bsrr;
+
+	while((timer->SR & (TIM_SR_CC1IF << channel_num)) == 0)
+	{
+		if((uint16_t)(timer->CNT - start_count) > TPD_TIMEOUT_TICKS) break;
+	}
+
+	if(timer->SR & (TIM_SR_CC1IF << channel_num))
+	{
+		tpd_ticks = (uint16_t)((&timer->CCR1)[channel_num] - start_count);
+		tpd_ticks = (tpd_ticks > TPD_LATENCY_TICKS) ? (tpd_ticks - TPD_LATENCY_TICKS) : 0;
+	}
+
+	timer->CCER &= ~(TIM_CCER_CC1E << (channel_num*4));
+	return tpd_ticks;
 }
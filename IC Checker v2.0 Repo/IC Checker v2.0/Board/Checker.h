@@ -18,6 +18,104 @@
 * 	Completed test loop generic to IC, only needing IC parameters. Defines
 * 	for loop skipping created.
 *
+* 	10/16/2026:
+* 	Added CHECKER_PARALLEL_GATES option.
+*
+* 	10/16/2026:
+* 	Added CheckerGroupField and CheckerTestGroup for testing candidates
+* 	sharing input pins together. CheckerTestIC now takes a pointer.
+*
+* 	10/16/2026:
+* 	Replaced IC failure boolean functions with packed truth tables held
+* 	in IC_PARAMETERS_T.
+*
+* 	10/16/2026:
+* 	Added decision tree node structure and CheckerWalkTree.
+*
+* 	10/16/2026:
+* 	Added CYCLES_DELAY_RISE and CYCLES_DELAY_FALL.
+*
+* 	10/16/2026:
+* 	Added CHECKER_STABLE_SAMPLES, settle statistics and CheckerSettleStats.
+*
+* 	10/16/2026:
+* 	Added CheckerMeasureTpd.
+*
+* 	10/16/2026:
+* 	Added CHECKER_DMA_PLAYBACK option.
+*
+* 	10/16/2026:
+* 	Added gate fault diagnosis structure and CheckerDiagnoseIC.
+*
+* 	10/16/2026:
+* 	Added socket screen structure and CheckerScreenSocket.
+*
+* 	10/16/2026:
+* 	Added sequential test step and sequence structures, CheckerTestSequence
+* 	and CheckerScreenSequences. Added 74HC74 and 74HC164 designators.
+*
+* 	10/16/2026:
+* 	Added 14, 16, and 20 pin packages, selected with CheckerSelectPackage.
+* 	Pin fields widened to PIN_FIELD_T. IC_PARAMETERS_T packed, with pin
+* 	lists held by pointer, and given enable pins for buffers. Added 74HC540,
+* 	74HC541, 74HC75, 74HC138, and 74HC161 designators.
+*
+* 	10/16/2026:
+* 	Added output stage to IC_PARAMETERS_T. Added 74HC03, 74HC125, and
+* 	74HC126 designators.
+*
+* 	10/16/2026:
+* 	Added CHECKER_MAX_VECTORS, soak statistics structure, CheckerStartSoak
+* 	and CheckerRunSoak.
+*
+* 	10/16/2026:
+* 	Added CHECKER_SHMOO_NONE and CheckerShmooIC.
+*
+* 	10/16/2026:
+* 	Added CheckerSenseSocket.
+*
+* 	10/16/2026:
+* 	CheckerTestGroup checks candidates CHECKER_STEP_VECTORS vectors at a
+* 	time.
+*
+* 	10/16/2026:
+* 	Added input and output pin fields to IC_PARAMETERS_T. Truth table
+* 	definitions and IC designators moved to the generated ICTables.h.
+*
+* 	10/16/2026:
+* 	Added CHECKER_STEP_VECTORS, group test cursor structure,
+* 	CheckerStartGroup and CheckerStepGroup for group tests run in steps.
+*
+* 	10/16/2026:
+* 	Package pin table moved here from Checker.c as CHECKER_PACKAGE_PINS,
+* 	shared with Tools/ICLibGen.
+*
+* 	10/16/2026:
+* 	Added CHECKER_PACKAGE_NONE and CheckerSensePackage.
+*
+* 	10/16/2026:
+* 	Added shmoo cursor structure, CheckerStartShmoo and CheckerStepShmoo
+* 	for settle delay sweeps run in steps.
+*
+* 	10/16/2026:
+* 	Added diagnosis, sequential test, and delay measurement cursor
+* 	structures, with Start and Step functions for each.
+*
+* 	10/16/2026:
+* 	Added group vector count and expected words to IC_PARAMETERS_T.
+* 	CheckerTestIC takes a library and index, so its group is known.
+*
+* 	10/16/2026:
+* 	CheckerWalkTree given the pins the screen found driven.
+*
+* 	10/16/2026:
+* 	Removed the blocking wrappers (CheckerTestIC, CheckerTestGroup,
+* 	CheckerDiagnoseIC, CheckerShmooIC, CheckerTestSequence and
+* 	CheckerMeasureTpd), which had no callers.
+*
+* 	10/16/2026:
+* 	The bound on step run time is given once, with CHECKER_STEP_VECTORS.
+*
 * 	Created on: 12/09/2018
 * 	Author: Anthony Needles
 ******************************************************************************/
@@ -31,41 +129,280 @@
 // Delay determined to by oscilloscope testing for minimum time of assertion
 // for accurate output
 
+#define CYCLES_DELAY_RISE 10
+#define CYCLES_DELAY_FALL 10
+// Delay after a vector whose changed input pins all rose or all fell. Gray
+// code ordering changes one gate input per vector, so these only need to
+// cover a single transition. Vectors changing pins in both directions use
+// CYCLES_DELAY.
+
+#define CHECKER_STABLE_SAMPLES 3
+// Consecutive identical port samples needed to accept an output reading.
+// The settle delay of each vector is only a timeout, so the reading is
+// taken as soon as the outputs stop changing. Must cover the GPIO input
+// synchronizer delay of two clock cycles.
+
+#define CHECKER_MAX_PINS 20
+// Pins of the largest package, and of the socket. Pin numbers start at 1.
+
+#define CHECKER_MAX_GATES 9
+// Most gates (outputs) of any IC, single input gates filling a 20 pin
+// package
+
+#define CHECKER_TPD_NONE 0xFFFF
+// Propagation delay of a gate that could not be measured
+
+#define CHECKER_SHMOO_NONE 0xFF
+// Shortest passing settle delay of an IC that fails at every settle delay
+
 #define TRUE 1
+#define FALSE 0
 #define PASSED 1
 #define FAILED 0
 
-#define IC_74HC00_FAIL (in_A & in_B) != !out
-#define IC_74HC02_FAIL (in_A | in_B) != !out
-#define IC_74HC04_FAIL in_A != !out
-#define IC_74HC08_FAIL (in_A & in_B) != out
-#define IC_74HC10_FAIL (in_A & in_B & in_C) != !out
-#define IC_74HC20_FAIL (in_A & in_B & in_C & in_D) != !out
-#define IC_74HC27_FAIL (in_A | in_B | in_C) != !out
-#define IC_74HC86_FAIL (in_A ^ in_B) != out
-// IC failure boolean functions. Used to determine if test set of inputs
-// and read output matches expected results.
-
-typedef enum {IC_74HC00,
-			  IC_74HC02,
-			  IC_74HC04,
-			  IC_74HC08,
-			  IC_74HC10,
-			  IC_74HC20,
-			  IC_74HC27,
-			  IC_74HC86} IC_DESIGNATOR_T;
-// Unique identifier for each IC enumeration
+#define CHECKER_PARALLEL_GATES TRUE
+// When TRUE, all gates of an IC are given the same input combination at
+// once and checked from a single read of the ports. When FALSE, gates are
+// tested one at a time.
+
+#define CHECKER_DMA_PLAYBACK TRUE
+// When TRUE, a group's vectors are applied and its outputs read by DMA
+// paced by TIM2, then checked by the CPU afterwards. When FALSE, or when
+// a group reads a port C pin, the CPU applies and reads every vector.
+
+typedef enum {PACKAGE_DIP14,
+			  PACKAGE_DIP16,
+			  PACKAGE_DIP20,
+			  PACKAGE_DIP16_VCC5} CHECKER_PACKAGE_T;
+// IC packages the socket can take. Standard DIPs have GND on the last pin
+// of the first row and VCC on the last pin. PACKAGE_DIP16_VCC5 has VCC on
+// pin 5 and GND on pin 12 (e.g. 74HC75).
+
+#define CHECKER_NUM_PACKAGES 4
+// Number of CHECKER_PACKAGE_T entries
+
+#define CHECKER_PACKAGE_NONE 0xFF
+// Returned by CheckerSensePackage when no package is sensed. Also the
+// selected package before CheckerSelectPackage is first called, and after
+// either sense function, with the socket unpowered.
+
+typedef struct {
+	uint8_t num_pins;
+	uint8_t vcc_pin;
+	uint8_t gnd_pin;} PACKAGE_PINS_T;
+// Number of pins of a package, and its supply pins
+
+#define CHECKER_PACKAGE_PINS {				\
+	[PACKAGE_DIP14] = {14, 14, 7},			\
+	[PACKAGE_DIP16] = {16, 16, 8},			\
+	[PACKAGE_DIP20] = {20, 20, 10},			\
+	[PACKAGE_DIP16_VCC5] = {16, 5, 12} }
+// Number of pins, VCC pin, and GND pin of each package, indexed by
+// CHECKER_PACKAGE_T. Initializes the package table of Checker.c and those
+// of Tools/ICLibGen and Tools/ICTreeGen, so the library is checked, and
+// the tree built, against the supply pins the firmware powers.
 
+typedef uint32_t PIN_FIELD_T;
+// Pin field, bit n corresponds to package pin n
 
+typedef enum {OUTPUT_PUSH_PULL,
+			  OUTPUT_TRI_STATE,
+			  OUTPUT_OPEN_DRAIN} CHECKER_OUTPUT_T;
+// Output stage of an IC. Tri-state outputs are Hi-Z while the enable pins
+// are away from their enable levels. Open-drain outputs only drive low,
+// and are Hi-Z for a high output.
 
 typedef struct {
-	IC_DESIGNATOR_T ic_designator;
+	uint8_t ic_designator;
+	uint8_t package;
 	uint8_t num_inputs;
 	uint8_t num_outputs;
-	uint8_t input_pins[9];
-	uint8_t output_pins[6];} IC_PARAMETERS_T;
+	uint16_t truth_table;
+	uint8_t output_type;
+	uint8_t num_vectors;
+	const uint8_t *input_pins;
+	const uint8_t *output_pins;
+	const uint32_t *expect_words;
+	PIN_FIELD_T enable_field;
+	PIN_FIELD_T enable_levels;
+	PIN_FIELD_T input_field;
+	PIN_FIELD_T output_field;} IC_PARAMETERS_T;
 // Structure to hold various parameters for a given IC necessary
-// for testing
+// for testing. Every gate of the IC shares the same packed truth table,
+// where bit n holds the expected gate output when the gate inputs form the
+// value n, with input A as bit 0 and input D as bit 3 (e.g. for a 2 input
+// NAND gate, bit 3 is the output with A and B both high). Pin lists are
+// held in flash by pointer, so any number of gates fits and ICs with the
+// same pinout share one list. Enable pins (e.g. buffer output enables) are
+// held at enable_levels while the gates are tested. Designator, package,
+// and output stage (CHECKER_OUTPUT_T) are held as bytes to keep the
+// structure packed. Input (with enable) and output pin fields are worked
+// out ahead from the pin lists. The IC's group (see CheckerGroupField)
+// tests it with num_vectors vectors, and expect_words holds, for each block
+// of CHECKER_STEP_VECTORS of them, a care word (vectors holding the enable
+// pins at enable_levels) then one expected output word per gate, bit n for
+// vector n of the block. Entries are generated from Src/ICLibrary.icd by
+// Tools/ICLibGen.
+
+#define CHECKER_PIN(ic_pin) (1UL << (ic_pin))
+// Pin field with only the given package pin set
+
+typedef struct {
+	PIN_FIELD_T level_field;
+	PIN_FIELD_T clock_field;
+	PIN_FIELD_T expect_field;
+	PIN_FIELD_T check_field;} CHECKER_SEQ_STEP_T;
+// One step of a sequential test (bit n corresponds to package pin n). Input
+// pins are driven to level_field, then pins in clock_field are pulsed to
+// the opposite level and back (a low clock pin gets a rising then falling
+// edge). Output pins in check_field are then compared with expect_field.
+
+typedef struct {
+	uint8_t ic_designator;
+	uint8_t package;
+	uint8_t num_steps;
+	PIN_FIELD_T input_field;
+	PIN_FIELD_T output_field;
+	const CHECKER_SEQ_STEP_T *steps;} IC_SEQUENCE_T;
+// Structure to hold the pins and test sequence of a sequential IC. Steps
+// are run in order, so the first steps should force a known state with
+// the IC's reset or preset inputs. Steps without clock pins test
+// combinational ICs with several outputs per input (e.g. decoders).
+
+#define CHECKER_TREE_LEAF 0x80
+// Set in a decision tree link when it refers to a leaf rather than a node.
+// Lower seven bits then hold the leaf index.
+
+typedef struct {
+	PIN_FIELD_T drive_field;
+	PIN_FIELD_T level_field;
+	uint8_t read_pin;
+	uint8_t next[2];} CHECKER_TREE_NODE_T;
+// Decision tree node for candidate identification. Package pins set in
+// drive_field are driven to the levels in level_field (bit n corresponds
+// to package pin n), all other pins are read. Walk continues to next[0] or
+// next[1] depending on level read on read_pin. Tables of these nodes are
+// generated by Tools/ICTreeGen.
+
+typedef struct {
+	uint32_t num_reads;
+	uint32_t num_samples;
+	uint32_t num_timeouts;
+	uint8_t last_samples;
+	uint8_t max_samples;} CHECKER_SETTLE_STATS_T;
+// Output reading statistics since reset. Average samples per read is
+// num_samples/num_reads. Reads that reached the settle delay before the
+// outputs were stable are counted in num_timeouts.
+
+#define CHECKER_MAX_VECTORS 64
+// Largest number of distinct vectors a candidate group may require
+
+typedef struct {
+	uint32_t num_passes;
+	uint32_t num_failed_passes;
+	uint32_t num_reads;
+	uint32_t num_fails;
+	uint32_t vector_fails[CHECKER_MAX_VECTORS];
+	uint8_t num_vectors;} CHECKER_SOAK_T;
+// Soak test statistics of one IC. Each pass reads all num_vectors vectors
+// once. num_fails counts failed reads out of num_reads, and vector_fails
+// the failed reads of each vector (indexed in the order vectors are
+// applied).
+
+#define CHECKER_STEP_VECTORS 16
+// Most vectors checked by one CheckerStepGroup, CheckerStepShmoo, or
+// CheckerStepDiagnosis call, and most sequence steps run by one
+// CheckerStepSequence call (32 or less, one per bit of a word). This bounds
+// the run time of each call, however many vectors or steps the IC has.
+// Reads are CYCLES_DELAY or less each, and CheckerStepTpd measures one
+// gate per call.
+
+typedef struct {
+	const IC_PARAMETERS_T *library;
+	uint32_t live_field;
+	uint8_t library_size;
+	uint8_t num_vectors;
+	uint8_t next_vector;
+	uint8_t next_drive;} CHECKER_GROUP_T;
+// Place of a group test run in steps. live_field holds the candidates not
+// yet failed, next_vector the first vector left to check, and next_drive
+// the library index of the next candidate to have its output stage
+// checked once vectors are done.
+
+typedef struct {
+	uint8_t num_vectors;
+	uint8_t next_vector;
+	uint8_t pass_num;
+	uint8_t settle_cycles;
+	uint8_t min_cycles;} CHECKER_SHMOO_T;
+// Place of a settle delay sweep run in steps. settle_cycles holds the
+// delay being tried (0 once the sweep is done), pass_num and next_vector
+// the run of the vector list and vector reached at that delay, and
+// min_cycles the shortest delay passed so far.
+
+typedef struct {
+	const IC_SEQUENCE_T *IC;
+	uint8_t next_step;
+	uint8_t result;} CHECKER_SEQUENCE_T;
+// Place of a sequential test run in steps. next_step holds the first step
+// left to run, and result the test result so far.
+
+#define CHECKER_DIAG_NONE 0xFF
+// Faulty gates given by CheckerStepDiagnosis when the IC pins can not be
+// tested
+
+typedef enum {GATE_OK,
+			  GATE_STUCK_0,
+			  GATE_STUCK_1,
+			  GATE_INCONSISTENT} GATE_FAULT_T;
+// Fault classification of a single gate
+
+typedef struct {
+	uint16_t high_field;
+	uint16_t low_field;
+	uint16_t mismatch_field;
+	GATE_FAULT_T fault;} GATE_DIAG_T;
+// Diagnosis of a single gate. Bit n of each field refers to gate input
+// combination n (same indexing as the truth table), which is also the
+// vector number when gates are tested in parallel. high_field and
+// low_field hold the output levels read, mismatch_field the combinations
+// whose reading differed from the truth table.
+
+typedef struct {
+	const IC_PARAMETERS_T *IC;
+	GATE_DIAG_T *gate_diags;
+	uint8_t num_vectors;
+	uint8_t next_vector;
+	uint8_t num_faulty;} CHECKER_DIAG_T;
+// Place of a diagnosis run in steps. next_vector holds the first vector
+// left to read, and num_faulty the faulty gates once every vector is read.
+
+typedef struct {
+	const IC_PARAMETERS_T *IC;
+	uint16_t *tpd_ns;
+	uint8_t base_combo;
+	uint8_t edge_input;
+	uint8_t next_gate;
+	uint8_t num_gates;} CHECKER_TPD_T;
+// Place of a propagation delay measurement run in steps. base_combo holds
+// the gate input combination each gate is driven to, edge_input the gate
+// input changed to toggle its output, and next_gate the next gate of the
+// num_gates to measure.
+
+typedef struct {
+	PIN_FIELD_T driven_field;
+	PIN_FIELD_T short_field;
+	PIN_FIELD_T open_field;
+	PIN_FIELD_T stuck_field;
+	uint8_t num_faults;
+	uint8_t package;} CHECKER_SCREEN_T;
+// Result of the socket pin screen of one package (bit n corresponds to
+// package pin n).
+// driven_field holds pins that held their level against both internal
+// pulls, short_field pins found connected to another undriven pin.
+// open_field and stuck_field refer to the closest IC screened: its output
+// pins that were undriven, and its input pins that were driven.
+// num_faults is the number of faulty pins of the closest IC.
 
 /********************************************************************
 * CheckerInit - Initializes required checker peripherals
@@ -75,6 +412,9 @@ typedef struct {
 * 				in cycles. This timer will be used for delaying
 * 				small amounts to ensure any output gate change has
 * 				time to propagate the system. One pulse mode enabled.
+* 				Enables TIM2 clock for propagation delay capture and
+* 				DMA vector playback, and DMA1 clock. No package is
+* 				selected, so the socket is left unpowered.
 *
 * Return value:	None
 *
@@ -83,23 +423,447 @@ typedef struct {
 void CheckerInit(void);
 
 /********************************************************************
-* CheckerTestIC - Task for reading and debouncing current button press
+* CheckerSelectPackage - Maps and powers the socket for a package
+*
+* Description:  Packages sit top aligned in the 20 pin socket, so the
+* 				first half of their pins start at socket pin 1 and the
+* 				second half end at socket pin 20. Every socket pin is
+* 				first set to input with no pull, removing the supply of
+* 				the previous package. The package pin map and IO pin
+* 				field are then rebuilt, and the package's GND and VCC
+* 				pins are driven low and high. Functions taking an IC
+* 				select its package themselves, and nothing is changed
+* 				if the package is already selected. Powering a package
+* 				other than the inserted IC's drives its pins, so the
+* 				package should first be sensed by CheckerSensePackage.
+*
+* Return value:	Pass, or failure if package is unknown
+*
+* Arguments:    uint8_t package - CHECKER_PACKAGE_T to select
+********************************************************************/
+uint8_t CheckerSelectPackage(uint8_t);
+
+/********************************************************************
+* CheckerSenseSocket - Senses whether an IC is in the socket
+*
+* Description:  Any selected package is deselected, leaving the socket
+* 				unpowered with every pin an input. Socket pin
+* 				SENSE_SOCKET_PIN, the VCC pin of every top aligned
+* 				standard package, is pulled down and every other pin
+* 				pulled up. An empty socket reads the pin low. An
+* 				inserted IC, even unpowered, ties its pins to its
+* 				supply rails through its protection diodes, so the
+* 				pulled up pins lift its VCC rail and the pin reads high
+* 				(an IC with VCC elsewhere, e.g. 74HC75, lifts the pin
+* 				through the diode from its GND rail instead). The pin
+* 				is read after PULL_SETTLE_CYCLES, and pulls are left in
+* 				place so the socket stays weakly pulled between calls.
+*
+* Return value:	TRUE if an IC is sensed
+*
+* Arguments:    None
+********************************************************************/
+uint8_t CheckerSenseSocket(void);
+
+/********************************************************************
+* CheckerSensePackage - Finds the package of an unpowered IC
+*
+* Description:  Any selected package is deselected, leaving the socket
+* 				unpowered. For each socket pin that is the VCC pin of
+* 				a package, that pin is driven low and every other
+* 				socket pin pulled up (see checkerSenseLow). An IC
+* 				whose VCC pin is driven low pulls every one of its
+* 				other pins low through its protection diodes, its GND
+* 				pin through the diode between its supply rails. Empty
+* 				socket pins stay high, and so does the VCC pin of an
+* 				IC with its VCC elsewhere, which is on every package's
+* 				pins. A package is sensed when all its pins read low,
+* 				the package with the most pins if several are. Nothing
+* 				is driven high, so no IC pin is ever driven against,
+* 				and the socket is left with every pin pulled up.
+*
+* Return value:	CHECKER_PACKAGE_T sensed, or CHECKER_PACKAGE_NONE
+*
+* Arguments:    None
+********************************************************************/
+uint8_t CheckerSensePackage(void);
+
+/********************************************************************
+* CheckerGroupField - Finds all candidates sharing an IC's input pins
+*
+* Description:  Compares the input pins of the given library entry
+* 				with every other entry. All entries of the same package
+* 				driven on exactly the same pins can share one set of
+* 				stimulus and are returned as one group.
+*
+* Return value:	Bit field of library entries in the group (bit n
+* 				corresponds to library[n])
+*
+* Arguments:    const IC_PARAMETERS_T *library - Array of candidate
+* 				IC parameters
+*
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				uint8_t ic_index - Index of library entry to group
+********************************************************************/
+uint32_t CheckerGroupField(const IC_PARAMETERS_T *, uint8_t, uint8_t);
+
+/********************************************************************
+* CheckerStartGroup - Prepares a group test to be run in steps
+*
+* Description:  Vectors are built for every library entry sharing the
+* 				candidates' input pins (see CheckerGroupField), even
+* 				when only some are tested, so they match the expected
+* 				words generated for each candidate. Duplicates are
+* 				shared, and the group's cursor is set to the first
+* 				vector. Every candidate starts alive, unless its pins
+* 				can not be tested or its expected words were generated
+* 				for another vector list. The vectors stay built until
+* 				another function tests an IC, so one group is tested at
+* 				a time. Made generically for any boolean logic 74HCXX
+* 				IC with four or less inputs per gate, so test time
+* 				depends on the number of distinct pinouts rather than
+* 				the number of candidates.
+*
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *library - Array of candidate
+* 				IC parameters
+*
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				uint32_t group_field - Bit field of library entries
+* 				to test, all sharing the same input pins
+*
+* 				CHECKER_GROUP_T *group - Group test cursor to set
+********************************************************************/
+void CheckerStartGroup(const IC_PARAMETERS_T *, uint8_t, uint32_t, CHECKER_GROUP_T *);
+
+/********************************************************************
+* CheckerStepGroup - Runs the next step of a group test
+*
+* Description:  While vectors are left and a candidate is alive, the
+* 				next CHECKER_STEP_VECTORS vectors are applied, read and
+* 				checked against every live candidate at once. Failed
+* 				candidates are cleared from the live field. Each later
+* 				step checks the output stage of one candidate still
+* 				alive.
+*
+* Return value:	TRUE once the group test is done, with the candidates
+* 				that passed left in the group's live field
+*
+* Arguments:    CHECKER_GROUP_T *group - Group test cursor from
+* 				CheckerStartGroup, updated
+********************************************************************/
+uint8_t CheckerStepGroup(CHECKER_GROUP_T *);
+
+/********************************************************************
+* CheckerStartDiagnosis - Prepares a diagnosis to be run in steps
+*
+* Description:  Builds the IC's vectors as a single candidate group,
+* 				clears every gate diagnosis, and sets the diagnosis'
+* 				cursor to the first vector. The diagnosis is left done,
+* 				with CHECKER_DIAG_NONE faulty gates, if the IC pins can
+* 				not be tested. The vectors stay built until another
+* 				function tests an IC.
+*
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters
+*
+* 				GATE_DIAG_T *gate_diags - Array of CHECKER_MAX_GATES
+* 				gate diagnoses to fill by CheckerStepDiagnosis
+*
+* 				CHECKER_DIAG_T *diag - Diagnosis cursor to set
+********************************************************************/
+void CheckerStartDiagnosis(const IC_PARAMETERS_T *, GATE_DIAG_T *, CHECKER_DIAG_T *);
+
+/********************************************************************
+* CheckerStepDiagnosis - Runs the next step of a diagnosis
+*
+* Description:  The next CHECKER_STEP_VECTORS vectors (or fewer at the
+* 				end) are applied and read, even after a mismatch. For
+* 				each gate, the output level read and any mismatch with
+* 				the truth table is recorded against the gate input
+* 				combination. Once every vector is read, each gate with
+* 				mismatches is classified as stuck at 0 if it never read
+* 				high, stuck at 1 if it never read low, and inconsistent
+* 				otherwise.
+*
+* Return value:	TRUE once the diagnosis is done, with the number of
+* 				faulty gates left in the diagnosis' num_faulty
+*
+* Arguments:    CHECKER_DIAG_T *diag - Diagnosis cursor from
+* 				CheckerStartDiagnosis, updated
+********************************************************************/
+uint8_t CheckerStepDiagnosis(CHECKER_DIAG_T *);
+
+/********************************************************************
+* CheckerStartSoak - Prepares an IC for repeated testing
+*
+* Description:  Builds the IC's vectors as CheckerStartDiagnosis does and
+* 				works out the expected output levels of every vector
+* 				from the truth table once, so each soak pass only has
+* 				to compare readings. Soak statistics are cleared. The
+* 				vectors stay built until another function tests an IC.
+* 				No vector is applied, so run time is bounded by
+* 				building CHECKER_MAX_VECTORS vectors or less.
+*
+* Return value:	Pass, or failure if IC pins can not be tested
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters
+*
+* 				CHECKER_SOAK_T *soak - Soak statistics to clear
+********************************************************************/
+uint8_t CheckerStartSoak(const IC_PARAMETERS_T *, CHECKER_SOAK_T *);
+
+/********************************************************************
+* CheckerRunSoak - Reruns the vectors of a soaked IC
+*
+* Description:  Every pass applies and reads the whole vector list
+* 				built by CheckerStartSoak, by DMA playback when
+* 				possible, and compares each reading with its expected
+* 				levels. Unlike a group test, a pass does not stop at
+* 				a mismatch. Failed reads are counted per vector, and a
+* 				pass with any failed read is counted as a failed pass.
+*
+* Return value:	None
+*
+* Arguments:    CHECKER_SOAK_T *soak - Soak statistics from
+* 				CheckerStartSoak, updated
+*
+* 				uint16_t num_passes - Number of passes to run
+********************************************************************/
+void CheckerRunSoak(CHECKER_SOAK_T *, uint16_t);
+
+/********************************************************************
+* CheckerStartShmoo - Prepares a settle delay sweep to be run in steps
+*
+* Description:  Builds the IC's vectors and expected output levels as
+* 				CheckerStartSoak does, and sets the sweep's cursor to
+* 				the first vector at CYCLES_DELAY. The sweep is left
+* 				done if the IC pins can not be tested. The vectors stay
+* 				built until another function tests an IC.
+*
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters
+*
+* 				CHECKER_SHMOO_T *shmoo - Sweep cursor to set
+********************************************************************/
+void CheckerStartShmoo(const IC_PARAMETERS_T *, CHECKER_SHMOO_T *);
+
+/********************************************************************
+* CheckerStepShmoo - Runs the next step of a settle delay sweep
+*
+* Description:  The next CHECKER_STEP_VECTORS vectors of the vector
+* 				list (or fewer at its end) are applied and read at the
+* 				sweep's settle delay. Unlike a normal test, outputs are
+* 				read once when the TIM22 one pulse delay ends rather
+* 				than as soon as they are stable (see
+* 				checkerReadSettled), so each read is exactly its delay
+* 				after the vector is applied. Once the list has been run
+* 				SHMOO_PASSES times, the delay is passed and the next
+* 				step starts over one TIM22 cycle shorter. The sweep
+* 				ends at the first failed read or after SHMOO_MIN_CYCLES
+* 				passes.
+*
+* Return value:	TRUE once the sweep is done, with the shortest passing
+* 				settle delay (or CHECKER_SHMOO_NONE) left in the
+* 				sweep's min_cycles
+*
+* Arguments:    CHECKER_SHMOO_T *shmoo - Sweep cursor from
+* 				CheckerStartShmoo, updated
+********************************************************************/
+uint8_t CheckerStepShmoo(CHECKER_SHMOO_T *);
+
+/********************************************************************
+* CheckerScreenSocket - Screens socket pins for opens and shorts
+*
+* Description:  Every IO pin of the selected package is set to input
+* 				with a pull-down, then each low pin in turn is switched
+* 				to a pull-up and back. A pin that follows its pull is
+* 				undriven: an IC input, an unused pin, or a pin that does
+* 				not make contact. A pin that does not is driven by an IC
+* 				output (or shorted to one, or to a supply). The same is
+* 				repeated with every pin pulled up, and a pin is driven
+* 				if it was driven in either pass, so tri-state and
+* 				open-drain outputs left Hi-Z by one set of input levels
+* 				are driven by the other. Each undriven pin is then
+* 				driven high while the others stay pulled down, and any
+* 				other undriven pin reading high is shorted to it. Pulls
+* 				are removed afterwards. A library IC of the selected
+* 				package passes the screen when all its output pins are
+* 				driven, none of its input pins are driven, and none of
+* 				its pins are shorted.
+*
+* Return value:	Bit field of library ICs that passed the screen
+*
+* Arguments:    const IC_PARAMETERS_T *library - Array of candidate
+* 				IC parameters
+*
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				CHECKER_SCREEN_T *screen - Screen result to fill
+********************************************************************/
+uint32_t CheckerScreenSocket(const IC_PARAMETERS_T *, uint8_t, CHECKER_SCREEN_T *);
+
+/********************************************************************
+* CheckerScreenSequences - Screens sequential ICs against socket pins
 *
-* Description:  Main test structure. Performs testing by creating all
-* 				possible input combinations and reading resulting outputs.
-* 				Made generically for any boolean logic 74HCXX IC with
-* 				four or less inputs per gate. Gate inputs are labeled
-* 				A, B, C, and D. For gates with less than four inputs,
-* 				the loops for unused inputs are bypassed (e.g. two
-* 				input gates will only use A and B loops). Only required
-* 				input pins are set/cleared. If tests fails at any point
-* 				failure result is immediately sent.
+* Description:  Applies the pass rule of CheckerScreenSocket to each
+* 				sequential IC of the screened package using the pin
+* 				classification it already made, so no pins are tested
+* 				again. The closest IC in the screen result is replaced
+* 				if a sequential IC is closer.
+*
+* Return value:	Bit field of sequential ICs that passed the screen
+*
+* Arguments:    const IC_SEQUENCE_T *library - Array of sequential IC
+* 				pins and test sequences
+*
+* 				uint8_t library_size - Number of entries in library
+* 				(32 or less)
+*
+* 				CHECKER_SCREEN_T *screen - Result of
+* 				CheckerScreenSocket, updated
+********************************************************************/
+uint32_t CheckerScreenSequences(const IC_SEQUENCE_T *, uint8_t, CHECKER_SCREEN_T *);
+
+/********************************************************************
+* CheckerStartSequence - Prepares a sequential test to be run in steps
+*
+* Description:  The IC's package is selected, and the test's cursor is
+* 				set to the first step of the sequence. The test is left
+* 				done and failed if the IC pins can not be tested.
+*
+* Return value:	None
+*
+* Arguments:    const IC_SEQUENCE_T *IC - Structure holding IC pins
+* 				and test sequence
+*
+* 				CHECKER_SEQUENCE_T *sequence - Sequential test cursor
+* 				to set
+********************************************************************/
+void CheckerStartSequence(const IC_SEQUENCE_T *, CHECKER_SEQUENCE_T *);
+
+/********************************************************************
+* CheckerStepSequence - Runs the next steps of a sequential test
+*
+* Description:  The IC's input pins are driven and all other IO pins
+* 				read. For each of the next CHECKER_STEP_VECTORS steps
+* 				(or fewer at the end), the input levels are applied,
+* 				the clock pins are pulsed, and once the outputs settle
+* 				the checked outputs are compared with the expected
+* 				levels. The test ends failed at the first mismatch.
+* 				Each BSRR write is done in turn, so the step's data
+* 				inputs are set well before its clock edge. The IC keeps
+* 				its state between calls, as its pins stay driven.
+*
+* Return value:	TRUE once the test is done, with its result left in
+* 				the test's result
+*
+* Arguments:    CHECKER_SEQUENCE_T *sequence - Sequential test cursor
+* 				from CheckerStartSequence, updated
+********************************************************************/
+uint8_t CheckerStepSequence(CHECKER_SEQUENCE_T *);
+
+/********************************************************************
+* CheckerWalkTree - Narrows candidates with a decision tree
+*
+* Description:  Starting from the given link, each node's vector is
+* 				applied to the socket and its read pin is sampled to
+* 				choose the next link, until a leaf is reached. Each node
+* 				is generated to split the remaining candidates as evenly
+* 				as possible, so only a few vectors are needed. The leaf's
+* 				candidates still have to be confirmed with a full test.
+* 				The tree's package (IC_TREE_PACKAGE) must be selected.
+* 				Nodes never drive an output pin of a candidate they
+* 				split, but a node that would drive a pin the screen
+* 				found driven by the IC ends the walk with every
+* 				candidate left, to be group tested instead.
+*
+* Return value:	Bit field of candidates left at the leaf reached, or
+* 				every bit set if the walk was ended early
+*
+* Arguments:    const CHECKER_TREE_NODE_T *tree - Array of tree nodes
+*
+* 				const uint32_t *leaf_fields - Array of candidate bit
+* 				fields, one per leaf
+*
+* 				uint8_t root - Link to first node (or leaf)
+*
+* 				PIN_FIELD_T driven_field - Pins driven by the IC, from
+* 				CheckerScreenSocket
+********************************************************************/
+uint32_t CheckerWalkTree(const CHECKER_TREE_NODE_T *, const uint32_t *, uint8_t, PIN_FIELD_T);
+
+/********************************************************************
+* CheckerSettleStats - Gives output reading statistics
+*
+* Description:  Gives the number of port samples each output reading
+* 				needed before CHECKER_STABLE_SAMPLES agreed, which
+* 				tracks the real propagation delay of the IC in the
+* 				socket. main.c sends them after each result (see
+* 				SendSettle).
+*
+* Return value:	Pointer to settle statistics
+*
+* Arguments:    None
+********************************************************************/
+const CHECKER_SETTLE_STATS_T *CheckerSettleStats(void);
+
+/********************************************************************
+* CheckerStartTpd - Prepares a delay measurement to be run in steps
+*
+* Description:  The IC's package is selected and the socket is
+* 				configured for the IC, then an input combination and
+* 				gate input whose change toggles the gate output are
+* 				found from the truth table. Open-drain outputs are
+* 				pulled up. The measurement is left done, with no gates,
+* 				if the IC pins can not be tested.
+*
+* Return value:	None
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Structure holding IC
+* 				parameters, should be an IC that passed its test
+*
+* 				uint16_t *tpd_ns - Array of CHECKER_MAX_GATES delays
+* 				to fill by CheckerStepTpd
+*
+* 				CHECKER_TPD_T *tpd - Delay measurement cursor to set
+********************************************************************/
+void CheckerStartTpd(const IC_PARAMETERS_T *, uint16_t *, CHECKER_TPD_T *);
+
+/********************************************************************
+* CheckerStepTpd - Measures the next gate of a delay measurement
 *
+* Description:  If the next gate's output pin has a timer capture
+* 				channel (see checkerCaptureMap), the output pin is
+* 				switched to the timer alternate function, the gate is
+* 				driven to the measurement's input combination, and the
+* 				input is changed and changed back, timing both output
+* 				edges. The slower edge is the gate's delay. Only the
+* 				falling edge of open-drain outputs is used, as the
+* 				rising edge is the pull-up charging the pin. The gate
+* 				is measured from HSI16 with interrupts disabled so
+* 				timing is not disturbed, and the timer and system clock
+* 				are restored afterwards. Delays shorter than one tick
+* 				of TPD_CLOCK_MHZ read as zero.
 *
-* Return value:	Test pass or test failure
+* Return value:	TRUE once every gate has been measured
 *
-* Arguments:    IC_PARAMETERS_T IC - Structure holding IC parameters
+* Arguments:    CHECKER_TPD_T *tpd - Delay measurement cursor from
+* 				CheckerStartTpd, updated. Its delay array is filled in
+* 				nanoseconds, CHECKER_TPD_NONE for gates that can not be
+* 				measured.
 ********************************************************************/
-uint8_t CheckerTestIC(IC_PARAMETERS_T);
+uint8_t CheckerStepTpd(CHECKER_TPD_T *);
 
 #endif /* CHECKER_H_ */
@@ -20,6 +20,9 @@
 *	Completed testing of display functions and required reset delays. Updated
 *	all comments.
 *
+* 	10/16/2026:
+* 	Added LCDRepromptPending for deciding when Stop mode may be entered.
+*
 * 	Created on: 01/21/2019
 * 	Author: Anthony Needles
 ******************************************************************************/
@@ -357,6 +360,22 @@ void LCDDisplayString(const uint8_t *string)
 	TIM21->CR1 |= TIM_CR1_CEN;
 }
 
+/********************************************************************
+* LCDRepromptPending() - Tells whether the reprompt delay is running
+*
+* Description:  TIM21 halts in Stop mode, so Stop mode should not be
+* 				entered while the reprompt delay is being counted.
+*
+* Return value:	uint8_t - 1 while TIM21 counts the reprompt delay,
+* 				0 otherwise
+*
+* Arguments:    None
+********************************************************************/
+uint8_t LCDRepromptPending(void)
+{
+	return ((TIM21->CR1 & TIM_CR1_CEN) != 0) ? 1U : 0U;
+}
+
 /********************************************************************
 * TIM21_IRQHandler - Handles interrupt events for TIM21
 *
@@ -14,6 +14,9 @@
 *	Completed testing of display functions and required reset delays. Updated
 *	all comments.
 *
+* 	10/16/2026:
+* 	Added LCDRepromptPending for deciding when Stop mode may be entered.
+*
 * 	Created on: 01/21/2019
 * 	Author: Anthony Needles
 ******************************************************************************/
@@ -99,6 +102,19 @@ void LCDMoveCursor(uint8_t, uint8_t);
 ********************************************************************/
 void LCDDisplayString(const uint8_t *);
 
+/********************************************************************
+* LCDRepromptPending() - Tells whether the reprompt delay is running
+*
+* Description:  TIM21 halts in Stop mode, so Stop mode should not be
+* 				entered while the reprompt delay is being counted.
+*
+* Return value:	uint8_t - 1 while TIM21 counts the reprompt delay,
+* 				0 otherwise
+*
+* Arguments:    None
+********************************************************************/
+uint8_t LCDRepromptPending(void);
+
 /********************************************************************
 * TIM21_IRQHandler - Handles interrupt events for TIM21
 *
@@ -0,0 +1,81 @@
+/******************************************************************************
+* 	UART.c
+*
+* 	This source file handles the transmit only UART debug link. USART2 TX
+* 	(PA2) is wired to the ST-LINK virtual COM port on the Nucleo board, so
+* 	results can be read on a host terminal at 19200 baud, 8N1. Dependent on
+* 	2.097 MHz APB1 clock for baud rate.
+*
+* 	MCU: STM32L053R8
+*
+* 	10/16/2026:
+* 	Created and completed initialization and transmit string functions for
+* 	use as a debug link through the ST-LINK virtual COM port.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#include "stm32l053xx.h"
+#include "UART.h"
+
+/********************************************************************
+* Private Defines
+********************************************************************/
+#define GPIO_AFRL_AFSEL2_AF4 (0x4 << GPIO_AFRL_AFSEL2_Pos)
+#define TX_REG_EMPTY_FLAG ((USART2->ISR & USART_ISR_TXE_Msk) >> USART_ISR_TXE_Pos)
+#define TX_COMPLETE_FLAG ((USART2->ISR & USART_ISR_TC_Msk) >> USART_ISR_TC_Pos)
+#define SET 1U
+
+/********************************************************************
+* UARTInit - Initialization function for UART debug link
+*
+* Description:  Enables clocks for USART2 TX pin as well as USART2
+* 				module. PA2 is set to AF4 to select USART2 TX, which
+* 				the Nucleo board wires to the ST-LINK virtual COM
+* 				port. Transmitter enabled at 19200 baud, 8N1. Receive
+* 				is not used.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+void UARTInit(void)
+{
+	RCC->APB1ENR |= RCC_APB1ENR_USART2EN;
+	RCC->IOPENR |= RCC_IOPENR_IOPAEN;
+
+	GPIOA->MODER &= ~(GPIO_MODER_MODE2_Msk);
+	GPIOA->MODER |= GPIO_MODER_MODE2_1;
+	GPIOA->AFR[0] &= ~(GPIO_AFRL_AFSEL2_Msk);
+	GPIOA->AFR[0] |= GPIO_AFRL_AFSEL2_AF4;
+
+	USART2->BRR = UART_BAUD_DIVISOR;
+	USART2->CR1 |= (USART_CR1_TE | USART_CR1_UE);
+}
+
+/********************************************************************
+* UARTTxString - Transmits a string over UART debug link
+*
+* Description:  Each character is loaded into the transmit data
+* 				register when the register is empty, until the null
+* 				terminator is reached. Returns once the last character
+* 				has completely left the shift register, so the system
+* 				clock may be changed right after.
+*
+* Return value:	None
+*
+* Arguments:    const uint8_t *string - Pointer to start of array of
+* 				ASCII characters with null ('\0') termination
+********************************************************************/
+void UARTTxString(const uint8_t *string)
+{
+	while(*string != '\0')
+	{
+		while(TX_REG_EMPTY_FLAG != SET){}
+
+		USART2->TDR = *string;
+		string++;
+	}
+
+	while(TX_COMPLETE_FLAG != SET){}
+}
@@ -0,0 +1,55 @@
+/******************************************************************************
+* 	UART.h
+*
+* 	Header for UART.c
+*
+* 	MCU: STM32L053R8
+*
+* 	10/16/2026:
+* 	Created and completed initialization and transmit string functions for
+* 	use as a debug link through the ST-LINK virtual COM port.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#ifndef UART_H_
+#define UART_H_
+
+/********************************************************************
+* Public Definitions
+********************************************************************/
+#define UART_BAUD_DIVISOR 109
+// 2.097 MHz / 19200 baud, 0.2% error
+
+/********************************************************************
+* UARTInit - Initialization function for UART debug link
+*
+* Description:  Enables clocks for USART2 TX pin as well as USART2
+* 				module. PA2 is set to AF4 to select USART2 TX, which
+* 				the Nucleo board wires to the ST-LINK virtual COM
+* 				port. Transmitter enabled at 19200 baud, 8N1. Receive
+* 				is not used.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+void UARTInit(void);
+
+/********************************************************************
+* UARTTxString - Transmits a string over UART debug link
+*
+* Description:  Each character is loaded into the transmit data
+* 				register when the register is empty, until the null
+* 				terminator is reached. Returns once the last character
+* 				has completely left the shift register, so the system
+* 				clock may be changed right after.
+*
+* Return value:	None
+*
+* Arguments:    const uint8_t *string - Pointer to start of array of
+* 				ASCII characters with null ('\0') termination
+********************************************************************/
+void UARTTxString(const uint8_t *);
+
+#endif /* UART_H_ */
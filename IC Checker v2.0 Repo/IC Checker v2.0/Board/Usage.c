@@ -0,0 +1,269 @@
+/******************************************************************************
+* 	Usage.c
+*
+* 	This source file keeps usage counters (how often each IC has been
+* 	identified) in the STM32L053's data EEPROM, so they survive power down.
+* 	Counters are saved as whole records written round a ring of slots,
+* 	levelling wear over the 2 KB of data EEPROM, one word per time slice.
+*
+* 	MCU: STM32L053R8
+*
+* 	10/16/2026:
+* 	Created and completed initialization, count, and write task functions
+* 	for usage counters kept in data EEPROM.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#include "stm32l053xx.h"
+#include "Usage.h"
+
+/********************************************************************
+* Private Defines
+********************************************************************/
+#define PEKEY1 0x89ABCDEFUL
+#define PEKEY2 0x02030405UL
+// Data EEPROM unlock keys, written in order to PEKEYR
+
+#define COUNT_WORDS (USAGE_MAX_COUNTERS/2U)
+#define HEADER_WORD COUNT_WORDS
+#define RECORD_WORDS (COUNT_WORDS + 1U)
+// Record layout: two 16 bit counts per word (even counter in the lower
+// half), then a header word holding the record sequence number in the
+// upper half and the count check in the lower half
+
+#define NUM_SLOTS ((DATA_EEPROM_END - DATA_EEPROM_BASE + 1UL)/(RECORD_WORDS*4UL))
+// Records in the data EEPROM ring (30 for 2 KB)
+
+#define SLOT_WORD(slot, word) (*(volatile uint32_t *)(DATA_EEPROM_BASE + ((((slot)*RECORD_WORDS) + (word))*4UL)))
+// Data EEPROM word of a record slot
+
+#define COUNT_MAX 0xFFFFU
+// Largest count, reached before every count is halved
+
+#define WRITE_IDLE 0xFF
+// usageWriteWord when no record is being written
+
+#define SET 1U
+#define CLEAR 0U
+
+/********************************************************************
+* Private Function Prototypes
+********************************************************************/
+static uint16_t usageCheck(const uint16_t *);
+static uint8_t usageNewer(uint16_t, uint16_t);
+
+/********************************************************************
+* Private Global Variables
+********************************************************************/
+static uint16_t usageCounts[USAGE_MAX_COUNTERS];
+// Current counts, saved to data EEPROM by UsageWriteTask
+
+static uint32_t usageRecord[RECORD_WORDS];
+// Record being written, taken from usageCounts when its write started
+
+static uint8_t usageSlot;
+static uint16_t usageSequence;
+// Slot and sequence number of the newest record
+
+static uint8_t usageWriteWord = WRITE_IDLE;
+// Next word of usageRecord to write, WRITE_IDLE when none
+
+static uint8_t usageChanged = CLEAR;
+// SET when usageCounts changed since the last record was started
+
+/********************************************************************
+* UsageInit - Initialization function for usage counters
+*
+* Description:  Every slot of the ring is read, and a record is valid
+* 				when its header check matches its counts. Erased data
+* 				EEPROM reads as 0, which never matches. The valid record
+* 				with the newest sequence number is loaded as the current
+* 				counts. With no valid record, every count starts at 0
+* 				and the first record is written to slot 0.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+void UsageInit(void)
+{
+	uint16_t slot_counts[USAGE_MAX_COUNTERS];
+	uint32_t header;
+	uint8_t found = CLEAR;
+
+	usageSlot = NUM_SLOTS - 1U;
+	usageSequence = 0;
+	for(uint8_t counter = 0; counter < USAGE_MAX_COUNTERS; counter++)
+	{
+		usageCounts[counter] = 0;
+	}
+
+	for(uint8_t slot = 0; slot < NUM_SLOTS; slot++)
+	{
+		for(uint8_t word = 0; word < COUNT_WORDS; word++)
+		{
+			slot_counts[2U*word] = (uint16_t)SLOT_WORD(slot, word);
+			slot_counts[2U*word + 1U] = (uint16_t)(SLOT_WORD(slot, word) >> 16);
+		}
+		header = SLOT_WORD(slot, HEADER_WORD);
+
+		if(((uint16_t)header == usageCheck(slot_counts)) &&
+		   ((found == CLEAR) || (usageNewer((uint16_t)(header >> 16), usageSequence) == SET)))
+		{
+			found = SET;
+			usageSlot = slot;
+			usageSequence = (uint16_t)(header >> 16);
+			for(uint8_t counter = 0; counter < USAGE_MAX_COUNTERS; counter++)
+			{
+				usageCounts[counter] = slot_counts[counter];
+			}
+		}
+	}
+}
+
+/********************************************************************
+* UsageCount - Counts one use of a counter
+*
+* Description:  The count is raised in RAM and the counters are marked
+* 				to be saved by UsageWriteTask. Once a count would pass
+* 				COUNT_MAX, every count is halved first, so counts keep
+* 				their order and older uses slowly weigh less.
+*
+* Return value:	None
+*
+* Arguments:    uint8_t counter - Index of counter to raise (less than
+* 				USAGE_MAX_COUNTERS)
+********************************************************************/
+void UsageCount(uint8_t counter)
+{
+	if(counter >= USAGE_MAX_COUNTERS) return;
+
+	if(usageCounts[counter] == COUNT_MAX)
+	{
+		for(uint8_t count_index = 0; count_index < USAGE_MAX_COUNTERS; count_index++)
+		{
+			usageCounts[count_index] >>= 1;
+		}
+	}
+	usageCounts[counter]++;
+	usageChanged = SET;
+}
+
+/********************************************************************
+* UsageGet - Gives the count of a counter
+*
+* Description:  Counts are only meaningful against each other, as they
+* 				are halved together.
+*
+* Return value:	uint16_t - Uses counted, 0 for an invalid counter
+*
+* Arguments:    uint8_t counter - Index of counter (less than
+* 				USAGE_MAX_COUNTERS)
+********************************************************************/
+uint16_t UsageGet(uint8_t counter)
+{
+	return (counter < USAGE_MAX_COUNTERS) ? usageCounts[counter] : 0;
+}
+
+/********************************************************************
+* UsageWriteTask - Saves changed counters to data EEPROM
+*
+* Description:  When idle with changed counters, a new record is taken
+* 				from the current counts for the slot after the newest
+* 				record, with the next sequence number. One word of the
+* 				record is then written per call, its header last, so a
+* 				reset mid record leaves the previous record as the
+* 				newest valid one. Each slot is written once every
+* 				NUM_SLOTS records. Words that already hold their value
+* 				are not rewritten. Data EEPROM is unlocked only for the
+* 				write, which is waited on before locking it again. A
+* 				word write stalls the CPU for up to two EEPROM program
+* 				times (about 6.4 ms), as code runs from the same NVM,
+* 				so this is called once per time slice.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+void UsageWriteTask(void)
+{
+	uint8_t slot = (usageSlot + 1U) % NUM_SLOTS;
+
+	if(usageWriteWord == WRITE_IDLE)
+	{
+		if(usageChanged == CLEAR) return;
+
+		for(uint8_t word = 0; word < COUNT_WORDS; word++)
+		{
+			usageRecord[word] = ((uint32_t)usageCounts[2U*word + 1U] << 16) | usageCounts[2U*word];
+		}
+		usageRecord[HEADER_WORD] = ((uint32_t)(uint16_t)(usageSequence + 1U) << 16) | usageCheck(usageCounts);
+		usageChanged = CLEAR;
+		usageWriteWord = 0;
+	}
+
+	if(SLOT_WORD(slot, usageWriteWord) != usageRecord[usageWriteWord])
+	{
+		if((FLASH->PECR & FLASH_PECR_PELOCK) != 0)
+		{
+			FLASH->PEKEYR = PEKEY1;
+			FLASH->PEKEYR = PEKEY2;
+		}
+
+		SLOT_WORD(slot, usageWriteWord) = usageRecord[usageWriteWord];
+		while((FLASH->SR & FLASH_SR_BSY) != 0){}
+
+		FLASH->PECR |= FLASH_PECR_PELOCK;
+	}
+
+	if(usageWriteWord == HEADER_WORD)
+	{
+		usageSlot = slot;
+		usageSequence++;
+		usageWriteWord = WRITE_IDLE;
+	} else
+	{
+		usageWriteWord++;
+	}
+}
+
+/********************************************************************
+* usageCheck - Computes the header check of a set of counts
+*
+* Description:  The complement of the 16 bit sum of every count, so a
+* 				slot of all 0 (erased) does not check.
+*
+* Return value:	uint16_t - Check value
+*
+* Arguments:    const uint16_t *counts - Array of USAGE_MAX_COUNTERS
+* 				counts
+********************************************************************/
+static uint16_t usageCheck(const uint16_t *counts)
+{
+	uint16_t sum = 0;
+
+	for(uint8_t counter = 0; counter < USAGE_MAX_COUNTERS; counter++)
+	{
+		sum += counts[counter];
+	}
+	return (uint16_t)~sum;
+}
+
+/********************************************************************
+* usageNewer - Compares two record sequence numbers
+*
+* Description:  Sequence numbers wrap at 16 bits. Valid records are
+* 				never more than NUM_SLOTS apart, so the difference
+* 				taken as signed tells which is newer.
+*
+* Return value:	SET if sequence is newer than reference
+*
+* Arguments:    uint16_t sequence - Sequence number to compare
+*
+* 				uint16_t reference - Sequence number compared against
+********************************************************************/
+static uint8_t usageNewer(uint16_t sequence, uint16_t reference)
+{
+	return ((int16_t)(uint16_t)(sequence - reference) > 0) ? SET : CLEAR;
+}
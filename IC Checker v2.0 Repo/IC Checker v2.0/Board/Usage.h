@@ -0,0 +1,84 @@
+/******************************************************************************
+* 	Usage.h
+*
+* 	Header for Usage.c
+*
+* 	MCU: STM32L053R8
+*
+* 	10/16/2026:
+* 	Created and completed initialization, count, and write task functions
+* 	for usage counters kept in data EEPROM.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#ifndef USAGE_H_
+#define USAGE_H_
+
+/********************************************************************
+* Public Definitions
+********************************************************************/
+#define USAGE_MAX_COUNTERS 32
+// Counters kept, one per bit of a result field
+
+/********************************************************************
+* UsageInit - Initialization function for usage counters
+*
+* Description:  Data EEPROM is searched for the newest valid counter
+* 				record, which is loaded as the current counts. With no
+* 				valid record (EEPROM never written), every count starts
+* 				at 0.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+void UsageInit(void);
+
+/********************************************************************
+* UsageCount - Counts one use of a counter
+*
+* Description:  The count is raised in RAM and the counters are marked
+* 				to be saved by UsageWriteTask. Once a count would pass
+* 				0xFFFF, every count is halved first, so counts keep
+* 				their order and older uses slowly weigh less.
+*
+* Return value:	None
+*
+* Arguments:    uint8_t counter - Index of counter to raise (less than
+* 				USAGE_MAX_COUNTERS)
+********************************************************************/
+void UsageCount(uint8_t);
+
+/********************************************************************
+* UsageGet - Gives the count of a counter
+*
+* Description:  Counts are only meaningful against each other, as they
+* 				are halved together.
+*
+* Return value:	uint16_t - Uses counted, 0 for an invalid counter
+*
+* Arguments:    uint8_t counter - Index of counter (less than
+* 				USAGE_MAX_COUNTERS)
+********************************************************************/
+uint16_t UsageGet(uint8_t);
+
+/********************************************************************
+* UsageWriteTask - Saves changed counters to data EEPROM
+*
+* Description:  Counters are saved as a new record in the next slot of
+* 				a ring of records, so writes are levelled over the
+* 				whole data EEPROM. One word of the record is written
+* 				per call, its header last, so a reset mid record leaves
+* 				the previous record as the newest valid one. Words that
+* 				already hold their value are not rewritten. A word write
+* 				stalls the CPU for up to two EEPROM program times (about
+* 				6.4 ms), so this is called once per time slice.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+void UsageWriteTask(void);
+
+#endif /* USAGE_H_ */
@@ -7,19 +7,25 @@ C_SRCS += \
 ../Board/Button.c \
 ../Board/Checker.c \
 ../Board/I2C.c \
-../Board/LCD.c 
+../Board/LCD.c \
+../Board/UART.c \
+../Board/Usage.c 
 
 OBJS += \
 ./Board/Button.o \
 ./Board/Checker.o \
 ./Board/I2C.o \
-./Board/LCD.o 
+./Board/LCD.o \
+./Board/UART.o \
+./Board/Usage.o 
 
 C_DEPS += \
 ./Board/Button.d \
 ./Board/Checker.d \
 ./Board/I2C.d \
-./Board/LCD.d 
+./Board/LCD.d \
+./Board/UART.d \
+./Board/Usage.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -4,16 +4,25 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Src/ICLibrary.c \
+../Src/ICTables.c \
+../Src/ICTree.c \
 ../Src/SysTick.c \
 ../Src/main.c \
 ../Src/system_stm32l0xx.c 
 
 OBJS += \
+./Src/ICLibrary.o \
+./Src/ICTables.o \
+./Src/ICTree.o \
 ./Src/SysTick.o \
 ./Src/main.o \
 ./Src/system_stm32l0xx.o 
 
 C_DEPS += \
+./Src/ICLibrary.d \
+./Src/ICTables.d \
+./Src/ICTree.d \
 ./Src/SysTick.d \
 ./Src/main.d \
 ./Src/system_stm32l0xx.d 
@@ -0,0 +1,243 @@
+/******************************************************************************
+* 	ICLibrary.c
+*
+* 	This source file holds the test sequences of every sequential IC the
+* 	checker can identify. Gate ICs are described in ICLibrary.icd, from which
+* 	Tools/ICLibGen generates ICTables.c.
+*
+* 	MCU: STM32L053R8
+*
+* 	10/16/2026:
+* 	Moved IC parameter library out of main.c.
+*
+* 	10/16/2026:
+* 	Added sequential IC library with 74HC74 and 74HC164 test sequences.
+* 	74HC75 and 74HC161 are 16 pin packages and do not fit the socket.
+*
+* 	10/16/2026:
+* 	Pin lists moved into shared arrays referenced by each entry, and every
+* 	entry given its package. Added 74HC540 and 74HC541 octal buffers, and
+* 	74HC75, 74HC138, and 74HC161 sequences for the 20 pin socket.
+*
+* 	10/16/2026:
+* 	Every entry given its output stage. Added 74HC03 open-drain NAND gates,
+* 	and 74HC125 and 74HC126 tri-state buffers.
+*
+* 	10/16/2026:
+* 	Gate IC library moved to ICLibrary.icd, and generated into ICTables.c
+* 	by Tools/ICLibGen.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#include <stdint.h>
+#include "Checker.h"
+#include "ICTables.h"
+#include "ICLibrary.h"
+
+/******************************************************************************
+* Private Definitions
+******************************************************************************/
+#define HC74_RD (CHECKER_PIN(1) | CHECKER_PIN(13))
+#define HC74_D (CHECKER_PIN(2) | CHECKER_PIN(12))
+#define HC74_1D CHECKER_PIN(2)
+#define HC74_2D CHECKER_PIN(12)
+#define HC74_CP (CHECKER_PIN(3) | CHECKER_PIN(11))
+#define HC74_SD (CHECKER_PIN(4) | CHECKER_PIN(10))
+#define HC74_Q (CHECKER_PIN(5) | CHECKER_PIN(9))
+#define HC74_1Q CHECKER_PIN(5)
+#define HC74_2Q CHECKER_PIN(9)
+#define HC74_QN (CHECKER_PIN(6) | CHECKER_PIN(8))
+#define HC74_1QN CHECKER_PIN(6)
+#define HC74_2QN CHECKER_PIN(8)
+// 74HC74 dual D flip-flop pins. Unnumbered fields hold the pin of both
+// flip-flops, which are tested together. Reset (RD) and set (SD) are
+// active low.
+
+#define HC164_DSA CHECKER_PIN(1)
+#define HC164_DSB CHECKER_PIN(2)
+#define HC164_CP CHECKER_PIN(8)
+#define HC164_MR CHECKER_PIN(9)
+#define HC164_Q0 CHECKER_PIN(3)
+#define HC164_Q1 CHECKER_PIN(4)
+#define HC164_Q2 CHECKER_PIN(5)
+#define HC164_Q3 CHECKER_PIN(6)
+#define HC164_Q4 CHECKER_PIN(10)
+#define HC164_Q5 CHECKER_PIN(11)
+#define HC164_Q6 CHECKER_PIN(12)
+#define HC164_Q7 CHECKER_PIN(13)
+#define HC164_Q (HC164_Q0 | HC164_Q1 | HC164_Q2 | HC164_Q3 | HC164_Q4 | HC164_Q5 | HC164_Q6 | HC164_Q7)
+// 74HC164 8 bit serial in, parallel out shift register pins. Serial data
+// is DSA AND DSB, master reset (MR) is active low.
+
+#define HC54X_OE (CHECKER_PIN(1) | CHECKER_PIN(19))
+// 74HC540 and 74HC541 output enable pins, both active low
+
+#define HC12X_OE (CHECKER_PIN(1) | CHECKER_PIN(4) | CHECKER_PIN(10) | CHECKER_PIN(13))
+// 74HC125 and 74HC126 output enable pins, one per buffer. Active low on the
+// 74HC125 and active high on the 74HC126.
+
+#define HC75_1D CHECKER_PIN(2)
+#define HC75_2D CHECKER_PIN(3)
+#define HC75_3D CHECKER_PIN(6)
+#define HC75_4D CHECKER_PIN(7)
+#define HC75_D (HC75_1D | HC75_2D | HC75_3D | HC75_4D)
+#define HC75_LE12 CHECKER_PIN(13)
+#define HC75_LE34 CHECKER_PIN(4)
+#define HC75_1Q CHECKER_PIN(16)
+#define HC75_2Q CHECKER_PIN(15)
+#define HC75_3Q CHECKER_PIN(10)
+#define HC75_4Q CHECKER_PIN(9)
+#define HC75_Q (HC75_1Q | HC75_2Q | HC75_3Q | HC75_4Q)
+#define HC75_1QN CHECKER_PIN(1)
+#define HC75_2QN CHECKER_PIN(14)
+#define HC75_3QN CHECKER_PIN(11)
+#define HC75_4QN CHECKER_PIN(8)
+#define HC75_QN (HC75_1QN | HC75_2QN | HC75_3QN | HC75_4QN)
+// 74HC75 quad bistable latch pins (VCC on pin 5, GND on pin 12). Latches
+// are transparent while their enable (LE12 or LE34) is high.
+
+#define HC138_A0 CHECKER_PIN(1)
+#define HC138_A1 CHECKER_PIN(2)
+#define HC138_A2 CHECKER_PIN(3)
+#define HC138_E1 CHECKER_PIN(4)
+#define HC138_E2 CHECKER_PIN(5)
+#define HC138_E3 CHECKER_PIN(6)
+#define HC138_Y0 CHECKER_PIN(15)
+#define HC138_Y1 CHECKER_PIN(14)
+#define HC138_Y2 CHECKER_PIN(13)
+#define HC138_Y3 CHECKER_PIN(12)
+#define HC138_Y4 CHECKER_PIN(11)
+#define HC138_Y5 CHECKER_PIN(10)
+#define HC138_Y6 CHECKER_PIN(9)
+#define HC138_Y7 CHECKER_PIN(7)
+#define HC138_Y (HC138_Y0 | HC138_Y1 | HC138_Y2 | HC138_Y3 | HC138_Y4 | HC138_Y5 | HC138_Y6 | HC138_Y7)
+// 74HC138 3 to 8 line decoder pins. Outputs are active low. Enabled with
+// E1 and E2 low and E3 high.
+
+#define HC161_MR CHECKER_PIN(1)
+#define HC161_CP CHECKER_PIN(2)
+#define HC161_D0 CHECKER_PIN(3)
+#define HC161_D1 CHECKER_PIN(4)
+#define HC161_D2 CHECKER_PIN(5)
+#define HC161_D3 CHECKER_PIN(6)
+#define HC161_CEP CHECKER_PIN(7)
+#define HC161_PE CHECKER_PIN(9)
+#define HC161_CET CHECKER_PIN(10)
+#define HC161_RUN (HC161_MR | HC161_PE | HC161_CEP | HC161_CET)
+#define HC161_Q0 CHECKER_PIN(14)
+#define HC161_Q1 CHECKER_PIN(13)
+#define HC161_Q2 CHECKER_PIN(12)
+#define HC161_Q3 CHECKER_PIN(11)
+#define HC161_TC CHECKER_PIN(15)
+#define HC161_Q (HC161_Q0 | HC161_Q1 | HC161_Q2 | HC161_Q3 | HC161_TC)
+// 74HC161 4 bit binary counter pins. Master reset (MR) and parallel enable
+// (PE) are active low. Counts on a rising clock while CEP and CET are
+// high, terminal count (TC) is high at 15 while CET is high.
+
+/******************************************************************************
+* Private Constants
+******************************************************************************/
+static const CHECKER_SEQ_STEP_T hc74Steps[] = {
+	{HC74_SD, 0, HC74_QN, HC74_Q | HC74_QN},								// Reset
+	{HC74_RD | HC74_SD, 0, HC74_QN, HC74_Q | HC74_QN},						// Release, hold
+	{HC74_RD | HC74_SD | HC74_D, 0, HC74_QN, HC74_Q | HC74_QN},				// D high, no clock
+	{HC74_RD | HC74_SD | HC74_D, HC74_CP, HC74_Q, HC74_Q | HC74_QN},		// Clock in 1
+	{HC74_RD | HC74_SD, 0, HC74_Q, HC74_Q | HC74_QN},						// D low, no clock
+	{HC74_RD | HC74_SD, HC74_CP, HC74_QN, HC74_Q | HC74_QN},				// Clock in 0
+	{HC74_RD, 0, HC74_Q, HC74_Q | HC74_QN},									// Set
+	{HC74_RD | HC74_SD, 0, HC74_Q, HC74_Q | HC74_QN},						// Release, hold
+	{0, 0, HC74_Q | HC74_QN, HC74_Q | HC74_QN},								// Set and reset
+	{HC74_SD, 0, HC74_QN, HC74_Q | HC74_QN},								// Reset
+	{HC74_RD | HC74_SD | HC74_1D, HC74_CP, HC74_1Q | HC74_2QN, HC74_Q | HC74_QN},	// Flip-flops apart
+	{HC74_RD | HC74_SD | HC74_2D, HC74_CP, HC74_1QN | HC74_2Q, HC74_Q | HC74_QN} };
+// 74HC74 test sequence: input levels, clocked pins, expected outputs, and
+// checked outputs of each step
+
+static const CHECKER_SEQ_STEP_T hc164Steps[] = {
+	{0, 0, 0, HC164_Q},																	// Reset
+	{HC164_DSA | HC164_DSB, HC164_CP, 0, HC164_Q},											// Clock held in reset
+	{HC164_MR | HC164_DSA | HC164_DSB, HC164_CP, HC164_Q0, HC164_Q},						// Shift in 1
+	{HC164_MR | HC164_DSA, HC164_CP, HC164_Q1, HC164_Q},									// Shift in 0 (DSB low)
+	{HC164_MR | HC164_DSB, HC164_CP, HC164_Q2, HC164_Q},									// Shift in 0 (DSA low)
+	{HC164_MR | HC164_DSA | HC164_DSB, HC164_CP, HC164_Q0 | HC164_Q3, HC164_Q},
+	{HC164_MR | HC164_DSA | HC164_DSB, HC164_CP, HC164_Q0 | HC164_Q1 | HC164_Q4, HC164_Q},
+	{HC164_MR, HC164_CP, HC164_Q1 | HC164_Q2 | HC164_Q5, HC164_Q},
+	{HC164_MR | HC164_DSA | HC164_DSB, HC164_CP, HC164_Q0 | HC164_Q2 | HC164_Q3 | HC164_Q6, HC164_Q},
+	{HC164_MR, HC164_CP, HC164_Q1 | HC164_Q3 | HC164_Q4 | HC164_Q7, HC164_Q},
+	{HC164_MR, HC164_CP, HC164_Q2 | HC164_Q4 | HC164_Q5, HC164_Q},
+	{HC164_MR | HC164_DSA | HC164_DSB, 0, HC164_Q2 | HC164_Q4 | HC164_Q5, HC164_Q},		// Data high, no clock
+	{HC164_DSA | HC164_DSB, 0, 0, HC164_Q} };											// Reset
+// 74HC164 test sequence: input levels, clocked pins, expected outputs, and
+// checked outputs of each step
+
+static const CHECKER_SEQ_STEP_T hc75Steps[] = {
+	{HC75_LE12 | HC75_LE34, 0, HC75_QN, HC75_Q | HC75_QN},										// Transparent, D low
+	{HC75_LE12 | HC75_LE34 | HC75_D, 0, HC75_Q, HC75_Q | HC75_QN},								// Transparent, D high
+	{HC75_D, 0, HC75_Q, HC75_Q | HC75_QN},														// Latch
+	{0, 0, HC75_Q, HC75_Q | HC75_QN},															// Latched, D low
+	{HC75_LE12, 0, HC75_1QN | HC75_2QN | HC75_3Q | HC75_4Q, HC75_Q | HC75_QN},					// Latches 1 and 2 only
+	{0, 0, HC75_1QN | HC75_2QN | HC75_3Q | HC75_4Q, HC75_Q | HC75_QN},
+	{HC75_LE34 | HC75_1D | HC75_3D, 0, HC75_1QN | HC75_2QN | HC75_3Q | HC75_4QN, HC75_Q | HC75_QN},	// Latches 3 and 4 only
+	{HC75_1D | HC75_3D, 0, HC75_1QN | HC75_2QN | HC75_3Q | HC75_4QN, HC75_Q | HC75_QN},
+	{HC75_LE12 | HC75_LE34 | HC75_1D | HC75_4D, 0, HC75_1Q | HC75_2QN | HC75_3QN | HC75_4Q, HC75_Q | HC75_QN},
+	{HC75_1D | HC75_4D, 0, HC75_1Q | HC75_2QN | HC75_3QN | HC75_4Q, HC75_Q | HC75_QN},
+	{HC75_2D | HC75_3D, 0, HC75_1Q | HC75_2QN | HC75_3QN | HC75_4Q, HC75_Q | HC75_QN} };			// Latched, D inverted
+// 74HC75 test sequence: input levels, clocked pins, expected outputs, and
+// checked outputs of each step. D inputs only change while the enables
+// hold, since socket ports are written one after another
+
+static const CHECKER_SEQ_STEP_T hc138Steps[] = {
+	{HC138_E3, 0, HC138_Y & ~HC138_Y0, HC138_Y},										// Enabled, every address
+	{HC138_E3 | HC138_A0, 0, HC138_Y & ~HC138_Y1, HC138_Y},
+	{HC138_E3 | HC138_A1, 0, HC138_Y & ~HC138_Y2, HC138_Y},
+	{HC138_E3 | HC138_A1 | HC138_A0, 0, HC138_Y & ~HC138_Y3, HC138_Y},
+	{HC138_E3 | HC138_A2, 0, HC138_Y & ~HC138_Y4, HC138_Y},
+	{HC138_E3 | HC138_A2 | HC138_A0, 0, HC138_Y & ~HC138_Y5, HC138_Y},
+	{HC138_E3 | HC138_A2 | HC138_A1, 0, HC138_Y & ~HC138_Y6, HC138_Y},
+	{HC138_E3 | HC138_A2 | HC138_A1 | HC138_A0, 0, HC138_Y & ~HC138_Y7, HC138_Y},
+	{HC138_E3 | HC138_E1 | HC138_A2 | HC138_A1 | HC138_A0, 0, HC138_Y, HC138_Y},		// Disabled by each enable
+	{HC138_E3 | HC138_E2, 0, HC138_Y, HC138_Y},
+	{HC138_A0, 0, HC138_Y, HC138_Y} };
+// 74HC138 test sequence: input levels, clocked pins, expected outputs, and
+// checked outputs of each step
+
+static const CHECKER_SEQ_STEP_T hc161Steps[] = {
+	{HC161_PE, 0, 0, HC161_Q},																		// Reset
+	{HC161_RUN, HC161_CP, HC161_Q0, HC161_Q},														// Count
+	{HC161_RUN, HC161_CP, HC161_Q1, HC161_Q},
+	{HC161_RUN, HC161_CP, HC161_Q1 | HC161_Q0, HC161_Q},
+	{HC161_MR | HC161_CEP | HC161_CET | HC161_D3 | HC161_D2 | HC161_D1, HC161_CP,
+	 HC161_Q3 | HC161_Q2 | HC161_Q1, HC161_Q},														// Load 14
+	{HC161_RUN, HC161_CP, HC161_Q3 | HC161_Q2 | HC161_Q1 | HC161_Q0 | HC161_TC, HC161_Q},			// Count to 15
+	{HC161_MR | HC161_PE | HC161_CEP, 0, HC161_Q3 | HC161_Q2 | HC161_Q1 | HC161_Q0, HC161_Q},		// CET low, no TC
+	{HC161_MR | HC161_PE | HC161_CET, HC161_CP, HC161_Q3 | HC161_Q2 | HC161_Q1 | HC161_Q0 | HC161_TC, HC161_Q},	// CEP low, hold
+	{HC161_RUN, HC161_CP, 0, HC161_Q},																// Wrap to 0
+	{HC161_MR | HC161_CEP | HC161_CET | HC161_D2 | HC161_D0, HC161_CP, HC161_Q2 | HC161_Q0, HC161_Q},	// Load 5
+	{HC161_MR | HC161_CEP | HC161_CET | HC161_D3 | HC161_D1, HC161_CP, HC161_Q3 | HC161_Q1, HC161_Q},	// Load 10
+	{HC161_MR | HC161_PE | HC161_D3 | HC161_D2 | HC161_D1 | HC161_D0, HC161_CP, HC161_Q3 | HC161_Q1, HC161_Q},	// Not enabled, hold
+	{HC161_PE, 0, 0, HC161_Q} };																	// Reset
+// 74HC161 test sequence: input levels, clocked pins, expected outputs, and
+// checked outputs of each step
+
+/******************************************************************************
+* Public Constants
+******************************************************************************/
+const IC_SEQUENCE_T ICSequenceLibrary[NUM_SEQUENCE_ICS] = {
+	{IC_74HC74, PACKAGE_DIP14, sizeof(hc74Steps)/sizeof(hc74Steps[0]),
+	 HC74_RD | HC74_D | HC74_CP | HC74_SD, HC74_Q | HC74_QN, hc74Steps},
+
+	{IC_74HC164, PACKAGE_DIP14, sizeof(hc164Steps)/sizeof(hc164Steps[0]),
+	 HC164_DSA | HC164_DSB | HC164_CP | HC164_MR, HC164_Q, hc164Steps},
+
+	{IC_74HC75, PACKAGE_DIP16_VCC5, sizeof(hc75Steps)/sizeof(hc75Steps[0]),
+	 HC75_D | HC75_LE12 | HC75_LE34, HC75_Q | HC75_QN, hc75Steps},
+
+	{IC_74HC138, PACKAGE_DIP16, sizeof(hc138Steps)/sizeof(hc138Steps[0]),
+	 HC138_A0 | HC138_A1 | HC138_A2 | HC138_E1 | HC138_E2 | HC138_E3, HC138_Y, hc138Steps},
+
+	{IC_74HC161, PACKAGE_DIP16, sizeof(hc161Steps)/sizeof(hc161Steps[0]),
+	 HC161_RUN | HC161_CP | HC161_D0 | HC161_D1 | HC161_D2 | HC161_D3, HC161_Q, hc161Steps} };
+// Sequential IC Parameters: IC Designator, package, number of steps, pin field of
+// input pins, pin field of output pins, and test sequence.
+// Library index n matches result bit NUM_LIBRARY_ICS + n in main.c.
@@ -0,0 +1,37 @@
+/******************************************************************************
+* 	ICLibrary.h
+*
+* 	Header for ICLibrary.c
+*
+* 	MCU: STM32L053R8
+*
+* 	10/16/2026:
+* 	Moved IC parameter library out of main.c so it can be shared with host
+* 	side table generators.
+*
+* 	10/16/2026:
+* 	Added sequential IC library.
+*
+* 	10/16/2026:
+* 	Added 74HC540, 74HC541, 74HC75, 74HC138, and 74HC161.
+*
+* 	10/16/2026:
+* 	Added 74HC03, 74HC125, and 74HC126.
+*
+* 	10/16/2026:
+* 	Gate IC library and library sizes moved to the generated ICTables.h.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#ifndef ICLIBRARY_H_
+#define ICLIBRARY_H_
+
+/******************************************************************************
+* Public Constants
+******************************************************************************/
+extern const IC_SEQUENCE_T ICSequenceLibrary[NUM_SEQUENCE_ICS];
+// Pins and test sequence of every sequential IC the checker can identify,
+// in the order of the sequence lines of ICLibrary.icd
+
+#endif /* ICLIBRARY_H_ */
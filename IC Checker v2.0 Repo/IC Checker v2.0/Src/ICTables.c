@@ -0,0 +1,138 @@
+/******************************************************************************
+* 	ICTables.c
+*
+* 	Generated by Tools/ICLibGen from ICLibrary.icd. Do not edit.
+*
+* 	MCU: STM32L053R8
+******************************************************************************/
+#include <stdint.h>
+#include "Checker.h"
+#include "ICTables.h"
+
+/******************************************************************************
+* Private Constants
+******************************************************************************/
+static const uint8_t ic74hc00Inputs[] = {1, 2, 4, 5, 9, 10, 12, 13};
+static const uint8_t ic74hc00Outputs[] = {3, 6, 8, 11};
+static const uint8_t ic74hc02Inputs[] = {2, 3, 5, 6, 8, 9, 11, 12};
+static const uint8_t ic74hc02Outputs[] = {1, 4, 10, 13};
+static const uint8_t ic74hc04Inputs[] = {1, 3, 5, 9, 11, 13};
+static const uint8_t ic74hc04Outputs[] = {2, 4, 6, 8, 10, 12};
+static const uint8_t ic74hc10Inputs[] = {1, 2, 13, 3, 4, 5, 9, 10, 11};
+static const uint8_t ic74hc10Outputs[] = {12, 6, 8};
+static const uint8_t ic74hc20Outputs[] = {6, 8};
+static const uint8_t ic74hc540Inputs[] = {2, 3, 4, 5, 6, 7, 8, 9};
+static const uint8_t ic74hc540Outputs[] = {18, 17, 16, 15, 14, 13, 12, 11};
+static const uint8_t ic74hc125Inputs[] = {2, 5, 9, 12};
+// Gate pin lists, shared by every IC with the same list
+
+static const uint32_t ic74hc00Expect[] = {
+	0x0000FFFF, 0x0000DEDB, 0x0000E3FB, 0x0000DEDB, 0x0000E3FB,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003};
+static const uint32_t ic74hc02Expect[] = {
+	0x0000000F, 0x00000001, 0x00000001, 0x00000001, 0x00000001};
+static const uint32_t ic74hc04Expect[] = {
+	0x00000003, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001};
+static const uint32_t ic74hc08Expect[] = {
+	0x0000FFFF, 0x00002124, 0x00001C04, 0x00002124, 0x00001C04,
+	0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
+static const uint32_t ic74hc10Expect[] = {
+	0x000000FF, 0x000000DF, 0x000000DF, 0x000000DF};
+static const uint32_t ic74hc20Expect[] = {
+	0x0000FFFF, 0x0000FFFB, 0x0000FFFB,
+	0x00000003, 0x00000003, 0x00000003};
+static const uint32_t ic74hc27Expect[] = {
+	0x000000FF, 0x00000001, 0x00000001, 0x00000001};
+static const uint32_t ic74hc86Expect[] = {
+	0x0000FFFF, 0x000058DA, 0x0000E38A, 0x000058DA, 0x0000E38A,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003};
+static const uint32_t ic74hc540Expect[] = {
+	0x00000003, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001};
+static const uint32_t ic74hc541Expect[] = {
+	0x00000003, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002};
+static const uint32_t ic74hc125Expect[] = {
+	0x00000001, 0x000031EC, 0x0000FC0C, 0x00006936, 0x00001F86,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001};
+static const uint32_t ic74hc126Expect[] = {
+	0x00000004, 0x000031EC, 0x0000FC0C, 0x00006936, 0x00001F86,
+	0x00000002, 0x00000001, 0x00000001, 0x00000001, 0x00000001};
+// Expected words of each block of CHECKER_STEP_VECTORS group vectors: care word,
+// then one output word per gate. Shared by every IC with the same words.
+
+/******************************************************************************
+* Public Constants
+******************************************************************************/
+const IC_PARAMETERS_T ICLibrary[NUM_LIBRARY_ICS] = {
+	[IC_74HC00] = {IC_74HC00, PACKAGE_DIP14, 8, 4, 0x0007, OUTPUT_PUSH_PULL, 18, ic74hc00Inputs, ic74hc00Outputs,
+		ic74hc00Expect, 0x000000, 0x000000, 0x003636, 0x000948},	// ~(A&B)
+	[IC_74HC02] = {IC_74HC02, PACKAGE_DIP14, 8, 4, 0x0001, OUTPUT_PUSH_PULL, 4, ic74hc02Inputs, ic74hc02Outputs,
+		ic74hc02Expect, 0x000000, 0x000000, 0x001B6C, 0x002412},	// ~(A|B)
+	[IC_74HC04] = {IC_74HC04, PACKAGE_DIP14, 6, 6, 0x0001, OUTPUT_PUSH_PULL, 2, ic74hc04Inputs, ic74hc04Outputs,
+		ic74hc04Expect, 0x000000, 0x000000, 0x002A2A, 0x001554},	// ~A
+	[IC_74HC08] = {IC_74HC08, PACKAGE_DIP14, 8, 4, 0x0008, OUTPUT_PUSH_PULL, 18, ic74hc00Inputs, ic74hc00Outputs,
+		ic74hc08Expect, 0x000000, 0x000000, 0x003636, 0x000948},	// A&B
+	[IC_74HC10] = {IC_74HC10, PACKAGE_DIP14, 9, 3, 0x007F, OUTPUT_PUSH_PULL, 8, ic74hc10Inputs, ic74hc10Outputs,
+		ic74hc10Expect, 0x000000, 0x000000, 0x002E3E, 0x001140},	// ~(A&B&C)
+	[IC_74HC20] = {IC_74HC20, PACKAGE_DIP14, 8, 2, 0x7FFF, OUTPUT_PUSH_PULL, 18, ic74hc00Inputs, ic74hc20Outputs,
+		ic74hc20Expect, 0x000000, 0x000000, 0x003636, 0x000140},	// ~(A&B&C&D)
+	[IC_74HC27] = {IC_74HC27, PACKAGE_DIP14, 9, 3, 0x0001, OUTPUT_PUSH_PULL, 8, ic74hc10Inputs, ic74hc10Outputs,
+		ic74hc27Expect, 0x000000, 0x000000, 0x002E3E, 0x001140},	// ~(A|B|C)
+	[IC_74HC86] = {IC_74HC86, PACKAGE_DIP14, 8, 4, 0x0006, OUTPUT_PUSH_PULL, 18, ic74hc00Inputs, ic74hc00Outputs,
+		ic74hc86Expect, 0x000000, 0x000000, 0x003636, 0x000948},	// A^B
+	[IC_74HC540] = {IC_74HC540, PACKAGE_DIP20, 8, 8, 0x0001, OUTPUT_TRI_STATE, 2, ic74hc540Inputs, ic74hc540Outputs,
+		ic74hc540Expect, 0x080002, 0x000000, 0x0803FE, 0x07F800},	// ~A
+	[IC_74HC541] = {IC_74HC541, PACKAGE_DIP20, 8, 8, 0x0002, OUTPUT_TRI_STATE, 2, ic74hc540Inputs, ic74hc540Outputs,
+		ic74hc541Expect, 0x080002, 0x000000, 0x0803FE, 0x07F800},	// A
+	[IC_74HC03] = {IC_74HC03, PACKAGE_DIP14, 8, 4, 0x0007, OUTPUT_OPEN_DRAIN, 18, ic74hc00Inputs, ic74hc00Outputs,
+		ic74hc00Expect, 0x000000, 0x000000, 0x003636, 0x000948},	// ~(A&B)
+	[IC_74HC125] = {IC_74HC125, PACKAGE_DIP14, 4, 4, 0x0002, OUTPUT_TRI_STATE, 18, ic74hc125Inputs, ic74hc00Outputs,
+		ic74hc125Expect, 0x002412, 0x000000, 0x003636, 0x000948},	// A
+	[IC_74HC126] = {IC_74HC126, PACKAGE_DIP14, 4, 4, 0x0002, OUTPUT_TRI_STATE, 18, ic74hc125Inputs, ic74hc00Outputs,
+		ic74hc126Expect, 0x002412, 0x002412, 0x003636, 0x000948} };	// A
+// Gate IC Parameters: IC Designator, package, # of inputs, # of outputs, gate truth
+// table, output stage, # of group vectors, list of input pins, list of output pins,
+// list of expected words, pin field of enable pins, pin field of enable levels, pin
+// field of input pins, and pin field of output pins. Gate function from the
+// description file follows each entry.
+
+const uint8_t ICNamePrompts[NUM_IC_DESIGNATORS][IC_NAME_SIZE] = {
+	"74HC00",
+	"74HC02",
+	"74HC04",
+	"74HC08",
+	"74HC10",
+	"74HC20",
+	"74HC27",
+	"74HC86",
+	"74HC540",
+	"74HC541",
+	"74HC03",
+	"74HC125",
+	"74HC126",
+	"74HC74",
+	"74HC164",
+	"74HC75",
+	"74HC138",
+	"74HC161"};
+// Name of each IC, indexed by IC designator
+
+const uint8_t ICPassPrompts[NUM_IC_DESIGNATORS][IC_PASS_SIZE] = {
+	"74HC00 Passed",
+	"74HC02 Passed",
+	"74HC04 Passed",
+	"74HC08 Passed",
+	"74HC10 Passed",
+	"74HC20 Passed",
+	"74HC27 Passed",
+	"74HC86 Passed",
+	"74HC540 Passed",
+	"74HC541 Passed",
+	"74HC03 Passed",
+	"74HC125 Passed",
+	"74HC126 Passed",
+	"74HC74 Passed",
+	"74HC164 Passed",
+	"74HC75 Passed",
+	"74HC138 Passed",
+	"74HC161 Passed"};
+// Shown when a single IC passes, indexed by IC designator
@@ -0,0 +1,56 @@
+/******************************************************************************
+* 	ICTables.h
+*
+* 	Generated by Tools/ICLibGen from ICLibrary.icd. Do not edit.
+*
+* 	MCU: STM32L053R8
+******************************************************************************/
+#ifndef ICTABLES_H_
+#define ICTABLES_H_
+
+/******************************************************************************
+* Public Definitions
+******************************************************************************/
+#define NUM_LIBRARY_ICS 13
+#define NUM_SEQUENCE_ICS 5
+#define NUM_IC_DESIGNATORS 18
+// Number of gate ICs in ICLibrary, of sequential ICs in ICSequenceLibrary
+// (ICLibrary.c), and of both
+
+#define IC_NAME_SIZE 8
+#define IC_PASS_SIZE 15
+// Size of each name and pass prompt, with null termination
+
+typedef enum {IC_74HC00,
+			  IC_74HC02,
+			  IC_74HC04,
+			  IC_74HC08,
+			  IC_74HC10,
+			  IC_74HC20,
+			  IC_74HC27,
+			  IC_74HC86,
+			  IC_74HC540,
+			  IC_74HC541,
+			  IC_74HC03,
+			  IC_74HC125,
+			  IC_74HC126,
+			  IC_74HC74,
+			  IC_74HC164,
+			  IC_74HC75,
+			  IC_74HC138,
+			  IC_74HC161} IC_DESIGNATOR_T;
+// IC designators, gate ICs then sequential ICs. Designator n is result
+// bit n in main.c.
+
+/******************************************************************************
+* Public Constants
+******************************************************************************/
+extern const IC_PARAMETERS_T ICLibrary[NUM_LIBRARY_ICS];
+// Parameters of every gate IC the checker can identify, indexed by IC
+// designator
+
+extern const uint8_t ICNamePrompts[NUM_IC_DESIGNATORS][IC_NAME_SIZE];
+extern const uint8_t ICPassPrompts[NUM_IC_DESIGNATORS][IC_PASS_SIZE];
+// Name and pass prompt of every IC, indexed by IC designator
+
+#endif /* ICTABLES_H_ */
@@ -0,0 +1,21 @@
+/******************************************************************************
+* 	ICTree.c
+*
+* 	Generated by Tools/ICTreeGen from ICLibrary. Do not edit.
+*
+* 	MCU: STM32L053R8
+******************************************************************************/
+#include <stdint.h>
+#include "Checker.h"
+#include "ICTree.h"
+
+/******************************************************************************
+* Public Constants
+******************************************************************************/
+const CHECKER_TREE_NODE_T ICTree[IC_TREE_NUM_NODES] = {
+	{0x0000, 0x0000, 0, {0x80, 0x80}} };
+// Decision tree nodes: drive field, level field, read pin, next links
+
+const uint32_t ICTreeLeaves[IC_TREE_NUM_LEAVES] = {
+	0x00001CFF };
+// Candidate bit fields left at each leaf
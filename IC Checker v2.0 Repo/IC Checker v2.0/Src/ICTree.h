@@ -0,0 +1,31 @@
+/******************************************************************************
+* 	ICTree.h
+*
+* 	Generated by Tools/ICTreeGen from ICLibrary. Do not edit.
+*
+* 	MCU: STM32L053R8
+******************************************************************************/
+#ifndef ICTREE_H_
+#define ICTREE_H_
+
+/******************************************************************************
+* Public Definitions
+******************************************************************************/
+#define IC_TREE_NUM_NODES 1
+#define IC_TREE_NUM_LEAVES 1
+#define IC_TREE_ROOT 0x80
+#define IC_TREE_DEPTH 0
+// Table sizes, link to first node, and most nodes visited in one walk
+
+#define IC_TREE_PACKAGE PACKAGE_DIP14
+#define IC_TREE_CANDIDATES 0x00001CFF
+// Package the tree is built for, and bit field of the library ICs it
+// identifies. Other ICs of the package are not covered by the tree.
+
+/******************************************************************************
+* Public Constants
+******************************************************************************/
+extern const CHECKER_TREE_NODE_T ICTree[IC_TREE_NUM_NODES];
+extern const uint32_t ICTreeLeaves[IC_TREE_NUM_LEAVES];
+
+#endif /* ICTREE_H_ */
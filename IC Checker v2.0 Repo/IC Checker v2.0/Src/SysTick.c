@@ -10,6 +10,18 @@
 * 	12/08/2018:
 * 	Added initialization and handler increments. Added wait task.
 *
+* 	10/16/2026:
+* 	Added SysTickGetCount for timing tasks that span many time slices.
+*
+* 	10/16/2026:
+* 	Wait task now sleeps (WFI) until the time slice ends instead of
+* 	spinning, or enters Stop mode woken by LPTIM1 when allowed with
+* 	SysTickAllowStop. Active and sleeping cycles are counted, fetched with
+* 	SysTickGetCycles.
+*
+* 	10/16/2026:
+* 	An early wakeup from Stop mode ends Stop mode for the rest of the wait.
+*
 * 	Created on: 12/08/2018
 * 	Author: Anthony Needles
 ******************************************************************************/
@@ -19,6 +31,10 @@
 // Cycles per millisecond dependent on use of 2.097 MHz low-power MSI
 #define CLKCYCLES_ONE_MS 2097
 
+// LPTIM1 ticks per millisecond from the 37 kHz LSI (typical, so Stop mode
+// time slices may be off by the LSI tolerance)
+#define LSI_TICKS_ONE_MS 37
+
 // 1ms global counting variable
 static volatile uint32_t systickCurrentCount;
 
@@ -28,12 +44,28 @@ static uint32_t systickLastCount;
 // Flag that allows ensuring initialization of SysTick
 static uint8_t systickInitFlag;
 
+// Nonzero when waits may use Stop mode, set by SysTickAllowStop
+static uint8_t systickStopAllowed;
+
+// Cycle count at the end of the last wait, where the active part of a slice
+// starts
+static uint64_t systickSliceStart;
+
+// Active and sleeping cycles counted since SysTickInit
+static SYSTICK_CYCLES_T systickCycles;
+
+static uint64_t systickCycleStamp(void);
+static void systickStop(uint32_t);
+
 /********************************************************************
 * SysTickInit - Initializes SysTick system
 *
 * Description:  Enables SysTick timer via CMSIS SysTick_Config with
 * 				with required clock cycles to result in 1ms interrupts.
 * 				Error value returned from SysTick_Config also passed back.
+* 				LSI is started to clock LPTIM1, which wakes the MCU from
+* 				Stop mode through EXTI line 29. The regulator is set to
+* 				low-power mode and VREFINT to off while in Stop mode.
 *
 * Return value: Error value returned from SysTick_Config
 *
@@ -44,6 +76,23 @@ uint32_t SysTickInit(void)
 	uint32_t st_error;
 	systickCurrentCount = 0;
 	systickInitFlag = 1;
+	systickStopAllowed = 0;
+	systickCycles.active_cycles = 0;
+	systickCycles.sleep_cycles = 0;
+
+	RCC->CSR |= RCC_CSR_LSION;
+	while((RCC->CSR & RCC_CSR_LSIRDY) == 0){}
+	RCC->CCIPR &= ~(RCC_CCIPR_LPTIM1SEL);
+	RCC->CCIPR |= RCC_CCIPR_LPTIM1SEL_0;
+	RCC->APB1ENR |= (RCC_APB1ENR_LPTIM1EN | RCC_APB1ENR_PWREN);
+
+	LPTIM1->IER = LPTIM_IER_ARRMIE;
+	EXTI->IMR |= EXTI_IMR_IM29;
+	NVIC_EnableIRQ(LPTIM1_IRQn);
+
+	PWR->CR &= ~(PWR_CR_PDDS);
+	PWR->CR |= (PWR_CR_LPSDSR | PWR_CR_ULP);
+
 	st_error = SysTick_Config(CLKCYCLES_ONE_MS);
 	return st_error;
 }
@@ -53,7 +102,13 @@ uint32_t SysTickInit(void)
 *
 * Description:  Upon first time pass saves current millisecond count
 * 				value. Every following call will result in program idle
-* 				until next time slice period.
+* 				until next time slice period. The core sleeps (WFI)
+* 				until each SysTick interrupt, or when Stop mode is
+* 				allowed, stops until LPTIM1 ends the slice. Interrupts
+* 				are masked from the elapsed time check until after the
+* 				sleep, so a tick between the two still wakes the core.
+* 				Cycles from the end of the last wait are counted as
+* 				active, and cycles spent waiting as sleeping.
 *
 * Return value: None
 *
@@ -61,14 +116,85 @@ uint32_t SysTickInit(void)
 ********************************************************************/
 void SysTickWaitTask(const uint32_t ts_period)
 {
+    uint64_t wait_start;
+    uint32_t elapsed_ms;
+
     if(systickInitFlag == 0){
-        while((systickCurrentCount - systickLastCount) < ts_period){}
+        wait_start = systickCycleStamp();
+        systickCycles.active_cycles += (wait_start - systickSliceStart);
+
+        __disable_irq();
+        while((elapsed_ms = (systickCurrentCount - systickLastCount)) < ts_period){
+            if(systickStopAllowed != 0){
+                systickStop(ts_period - elapsed_ms);
+            }else{
+                __WFI();
+            }
+            __enable_irq();
+            __disable_irq();
+        }
+        __enable_irq();
+
+        systickSliceStart = systickCycleStamp();
+        systickCycles.sleep_cycles += (systickSliceStart - wait_start);
     }else{
     	systickInitFlag = 0;
+    	systickSliceStart = systickCycleStamp();
     }
     systickLastCount = systickCurrentCount;
 }
 
+/********************************************************************
+* SysTickAllowStop - Selects sleep or Stop mode for waits
+*
+* Description:  Stop mode halts every clock but LSI, so it should only
+* 				be allowed while no timer or transfer needs to run
+* 				between time slices.
+*
+* Return value: None
+*
+* Arguments:    allow - Nonzero to allow Stop mode, 0 to sleep only
+********************************************************************/
+void SysTickAllowStop(const uint8_t allow)
+{
+	systickStopAllowed = allow;
+}
+
+/********************************************************************
+* SysTickGetCycles - Fetch function for active and sleeping cycles
+*
+* Description:  Cycles are system clock cycles (2.097 MHz MSI). Time
+* 				in Stop mode is counted as the cycles that would have
+* 				passed. Duty cycle is active_cycles over the sum of
+* 				both, taken as the difference of two fetches for a
+* 				given span.
+*
+* Return value: None
+*
+* Arguments:    cycles - Structure to copy cycle counts into
+********************************************************************/
+void SysTickGetCycles(SYSTICK_CYCLES_T *cycles)
+{
+	cycles->active_cycles = systickCycles.active_cycles;
+	cycles->sleep_cycles = systickCycles.sleep_cycles;
+}
+
+/********************************************************************
+* SysTickGetCount - Fetch function for millisecond count
+*
+* Description:  Returns milliseconds counted since SysTickInit. The
+* 				count wraps after about 49 days, so elapsed time should
+* 				be taken as the unsigned difference of two counts.
+*
+* Return value: Current millisecond count
+*
+* Arguments:    None
+********************************************************************/
+uint32_t SysTickGetCount(void)
+{
+	return systickCurrentCount;
+}
+
 /********************************************************************
 * SysTickHandler - Handles interrupts from SysTick timer
 *
@@ -83,3 +209,92 @@ void SysTick_Handler(void)
 {
 	systickCurrentCount++;
 }
+
+/********************************************************************
+* LPTIM1_IRQHandler - Handles interrupts from LPTIM1
+*
+* Description:  Interrupt occurs when a Stop mode wakeup period ends.
+* 				Clears the autoreload match flag, as the wait task has
+* 				already accounted for the period.
+*
+* Return value: None
+*
+* Arguments:    None
+********************************************************************/
+void LPTIM1_IRQHandler(void)
+{
+	LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+}
+
+/********************************************************************
+* systickCycleStamp - Gives system clock cycles since SysTickInit
+*
+* Description:  Milliseconds counted plus cycles into the current
+* 				millisecond from the SysTick down counter. The count is
+* 				read again until unchanged, so a tick between the two
+* 				reads is not missed.
+*
+* Return value: Cycle count
+*
+* Arguments:    None
+********************************************************************/
+static uint64_t systickCycleStamp(void)
+{
+	uint32_t ms_count;
+	uint32_t tick_value;
+
+	do{
+		ms_count = systickCurrentCount;
+		tick_value = SysTick->VAL;
+	}while(ms_count != systickCurrentCount);
+
+	return (((uint64_t)ms_count*CLKCYCLES_ONE_MS) + (CLKCYCLES_ONE_MS - 1U - tick_value));
+}
+
+/********************************************************************
+* systickStop - Enters Stop mode for up to a number of milliseconds
+*
+* Description:  LPTIM1 is started in single mode to match after
+* 				stop_ms, and the core enters Stop mode (SLEEPDEEP with
+* 				WFI). SysTick halts in Stop mode, so the milliseconds
+* 				slept are added to the count on wakeup: all of stop_ms
+* 				if LPTIM1 matched, or the whole milliseconds counted if
+* 				another interrupt woke the core first. Such an
+* 				interrupt (e.g. a button edge) may have started a timer
+* 				that halts in Stop mode, so the rest of the wait sleeps
+* 				instead, unless the wakeup was a SysTick interrupt
+* 				pending before Stop mode was entered. The system clock
+* 				wakes on MSI, as before Stop mode. Called with
+* 				interrupts masked, so the LPTIM1 interrupt is handled
+* 				once they are unmasked.
+*
+* Return value: None
+*
+* Arguments:    stop_ms - Milliseconds to stop for (1 to 1771)
+********************************************************************/
+static void systickStop(uint32_t stop_ms)
+{
+	uint32_t lptim_count;
+
+	LPTIM1->CR = LPTIM_CR_ENABLE;
+	LPTIM1->ARR = (stop_ms*LSI_TICKS_ONE_MS);
+	while((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0){}
+	LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+	LPTIM1->CR |= LPTIM_CR_SNGSTRT;
+
+	PWR->CR |= PWR_CR_CWUF;
+	SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+	__WFI();
+	SCB->SCR &= ~(SCB_SCR_SLEEPDEEP_Msk);
+
+	if((LPTIM1->ISR & LPTIM_ISR_ARRM) == 0){
+		do{
+			lptim_count = LPTIM1->CNT;
+		}while(lptim_count != LPTIM1->CNT);
+		stop_ms = (lptim_count/LSI_TICKS_ONE_MS);
+		if((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) == 0) systickStopAllowed = 0;
+	}
+	LPTIM1->CR = 0;
+
+	systickCurrentCount += stop_ms;
+}
@@ -8,18 +8,34 @@
 * 	12/08/2018:
 * 	Added initialization and handler increments.
 *
+* 	10/16/2026:
+* 	Added SysTickGetCount.
+*
+* 	10/16/2026:
+* 	Added cycle count structure, SysTickAllowStop, SysTickGetCycles, and
+* 	LPTIM1_IRQHandler.
+*
 * 	Created on: 12/08/2018
 * 	Author: Anthony Needles
 ******************************************************************************/
 #ifndef SYSTICK_H_
 #define SYSTICK_H_
 
+/********************************************************************
+* Public Definitions
+********************************************************************/
+typedef struct {
+	uint64_t active_cycles;
+	uint64_t sleep_cycles;} SYSTICK_CYCLES_T;
+// System clock cycles spent running tasks and waiting in SysTickWaitTask
+
 /********************************************************************
 * SysTickInit - Initializes SysTick system
 *
 * Description:  Enables SysTick timer via CMSIS SysTick_Config with
 * 				with required clock cycles to result in 1ms interrupts.
 * 				Error value returned from SysTick_Config also passed back.
+* 				LSI and LPTIM1 are set up to wake from Stop mode.
 *
 * Return value: st_error - Error value returned from SysTick_Config
 *
@@ -32,7 +48,9 @@ uint32_t SysTickInit(void);
 *
 * Description:  Upon first time pass saves current millisecond count
 * 				value. Every following call will result in program idle
-* 				until next time slice period.
+* 				until next time slice period. The core sleeps (WFI)
+* 				until each SysTick interrupt, or when Stop mode is
+* 				allowed, stops until LPTIM1 ends the slice.
 *
 * Return value: None
 *
@@ -40,6 +58,47 @@ uint32_t SysTickInit(void);
 ********************************************************************/
 void SysTickWaitTask(const uint32_t);
 
+/********************************************************************
+* SysTickAllowStop - Selects sleep or Stop mode for waits
+*
+* Description:  Stop mode halts every clock but LSI, so it should only
+* 				be allowed while no timer or transfer needs to run
+* 				between time slices.
+*
+* Return value: None
+*
+* Arguments:    allow - Nonzero to allow Stop mode, 0 to sleep only
+********************************************************************/
+void SysTickAllowStop(const uint8_t);
+
+/********************************************************************
+* SysTickGetCycles - Fetch function for active and sleeping cycles
+*
+* Description:  Cycles are system clock cycles (2.097 MHz MSI). Time
+* 				in Stop mode is counted as the cycles that would have
+* 				passed. Duty cycle is active_cycles over the sum of
+* 				both, taken as the difference of two fetches for a
+* 				given span.
+*
+* Return value: None
+*
+* Arguments:    cycles - Structure to copy cycle counts into
+********************************************************************/
+void SysTickGetCycles(SYSTICK_CYCLES_T *);
+
+/********************************************************************
+* SysTickGetCount - Fetch function for millisecond count
+*
+* Description:  Returns milliseconds counted since SysTickInit. The
+* 				count wraps after about 49 days, so elapsed time should
+* 				be taken as the unsigned difference of two counts.
+*
+* Return value: Current millisecond count
+*
+* Arguments:    None
+********************************************************************/
+uint32_t SysTickGetCount(void);
+
 /********************************************************************
 * SysTickHandler - Handles interrupts from SysTick timer
 *
@@ -52,4 +111,17 @@ void SysTickWaitTask(const uint32_t);
 ********************************************************************/
 void SysTick_Handler(void);
 
+/********************************************************************
+* LPTIM1_IRQHandler - Handles interrupts from LPTIM1
+*
+* Description:  Interrupt occurs when a Stop mode wakeup period ends.
+* 				Clears the autoreload match flag, as the wait task has
+* 				already accounted for the period.
+*
+* Return value: None
+*
+* Arguments:    None
+********************************************************************/
+void LPTIM1_IRQHandler(void);
+
 #endif /* SYSTICK_H_ */
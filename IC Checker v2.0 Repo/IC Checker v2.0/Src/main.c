@@ -20,6 +20,123 @@
 * 	added header include. NOTE: LCD init must be performed AFTER I2C init. Updated
 * 	all comments.
 *
+* 	10/16/2026:
+* 	Replaced the eight CHECK_74HCXX states with a single CHECK_GROUP state.
+* 	IC parameters moved into one library array, and candidates sharing the
+* 	same input pins are tested together in one time slice.
+*
+* 	10/16/2026:
+* 	Added gate truth table to each library entry.
+*
+* 	10/16/2026:
+* 	Moved IC library to ICLibrary.c. Added IDENTIFY state, which walks the
+* 	generated decision tree (ICTree.c) so only the candidates left at its
+* 	leaf are fully tested.
+*
+* 	10/16/2026:
+* 	Added MEASURE_DELAY state and DisplayTpd. With CHARACTERIZE_MODE, the
+* 	propagation delay of each gate of a passing IC is shown on the second
+* 	LCD line and sent over the new UART debug link.
+*
+* 	10/16/2026:
+* 	Added DIAGNOSE state. With DIAGNOSE_MODE, a failed test maps the faults
+* 	of every gate of each library IC. The fault map of every IC is sent
+* 	over the debug link, and the closest IC with its first faulty gate is
+* 	shown on the LCD.
+*
+* 	10/16/2026:
+* 	Added SCREEN state and DisplayScreen. Socket pins are screened for opens
+* 	and shorts before identification, and a bad insertion is shown right
+* 	away. Only ICs that pass the screen are tested.
+*
+* 	10/16/2026:
+* 	Added CHECK_SEQUENCE state, which tests the sequential ICs that passed
+* 	the screen once the combinational candidates are done. Added 74HC74
+* 	and 74HC164 results.
+*
+* 	10/16/2026:
+* 	SCREEN state now screens one package per time slice until an IC passes,
+* 	showing the closest screen of any package otherwise. The decision tree
+* 	is only walked for its own package. Added 74HC540, 74HC541, 74HC75,
+* 	74HC138, and 74HC161 results.
+*
+* 	10/16/2026:
+* 	Added 74HC03, 74HC125, and 74HC126 results. A diagnosis with no faulty
+* 	gate is not kept, as the failure is then in the output stage.
+*
+* 	10/16/2026:
+* 	Added SOAK_MODE with START_SOAK and SOAK states, which rerun a passing
+* 	IC's vectors for a number of passes or seconds and display its fail
+* 	rate (DisplaySoak). NumToString widened to 32 bit values.
+*
+* 	10/16/2026:
+* 	Added SHMOO_MODE and SHMOO state, which sweeps a passing IC's settle
+* 	delay and displays its speed grade (DisplayGrade). States after a
+* 	single pass now each check their own mode.
+*
+* 	10/16/2026:
+* 	Added PRODUCTION_MODE, where IDLE senses IC insertion and removal with
+* 	CheckerSenseSocket, starts tests by itself, and shows parts per hour
+* 	(DisplayPartsHour).
+*
+* 	10/16/2026:
+* 	Added START_GROUP state. CHECK_GROUP now steps the group test with
+* 	CheckerStepGroup, one step per slice, until the group is done.
+*
+* 	10/16/2026:
+* 	Identified ICs counted in data EEPROM (Usage.c). Candidate groups and
+* 	sequential ICs are tried most identified first (MostUsedIndex), and
+* 	with FIRST_PASS_MODE testing stops at the first that passes.
+*
+* 	10/16/2026:
+* 	Added STOP_MODE, allowing Stop mode between time slices while idle.
+* 	Each test start sends the active and sleeping cycles since the last
+* 	one over UART (SendDuty).
+*
+* 	10/16/2026:
+* 	Button debounced by interrupts, so ButtonDBReadTask is no longer run
+* 	from the super loop. Stop mode is held off while the button is being
+* 	debounced.
+*
+* 	10/16/2026:
+* 	IC names, pass prompts, and designators generated from ICLibrary.icd
+* 	into ICTables by Tools/ICLibGen. Per IC result masks and pass prompts
+* 	removed, and DisplayResult shows the pass prompt of the single result
+* 	bit set.
+*
+* 	10/16/2026:
+* 	IC names shown at LCD_NAME_COLUMN, worked out from IC_NAME_SIZE so the
+* 	longest name ends the first LCD line. DisplayFaults shows
+* 	DiagFaultyPrompt before the name, and the soak prompts are shortened,
+* 	so seven character names are no longer cut off.
+*
+* 	10/16/2026:
+* 	SCREEN state senses the inserted IC's package with the socket
+* 	unpowered (CheckerSensePackage) and only powers and screens that
+* 	package, rather than powering every package in turn.
+*
+* 	10/16/2026:
+* 	Added START_SHMOO state. SHMOO now steps the settle delay sweep with
+* 	CheckerStepShmoo, one step per slice, until the sweep is done.
+*
+* 	10/16/2026:
+* 	Added SCREEN_SEQUENCES, START_SEQUENCE, START_DIAGNOSE, and START_DELAY
+* 	states. Sequential ICs are screened in their own slice, and sequential
+* 	tests, diagnoses, and delay measurements are stepped one step per
+* 	slice, so no slice runs a whole IC.
+*
+* 	10/16/2026:
+* 	IDENTIFY gives CheckerWalkTree the pins the screen found driven, so
+* 	the walk never drives against the IC's outputs.
+*
+* 	10/16/2026:
+* 	A failed test only diagnoses the ICs that passed the screen, as the
+* 	inputs of the others are driven pins of the inserted IC.
+*
+* 	10/16/2026:
+* 	Each result sends the settle statistics of the test's output reads
+* 	over UART (SendSettle), so samples per read can be followed.
+*
 * 	Created on: 01/15/2019
 * 	Author: Anthony Needles
 ******************************************************************************/
@@ -29,6 +146,11 @@
 #include "Checker.h"
 #include "I2C.h"
 #include "LCD.h"
+#include "UART.h"
+#include "Usage.h"
+#include "ICTables.h"
+#include "ICLibrary.h"
+#include "ICTree.h"
 
 /******************************************************************************
 * Public Definitions
@@ -37,73 +159,177 @@
 // Super loop period created by SysTickWaitTask (in milliseconds)
 
 #define MASK_FAILURE 0x00000000
-#define MASK_74HC00 0x00000001
-#define MASK_74HC02 0x00000002
-#define MASK_74HC04 0x00000004
-#define MASK_74HC08 0x00000008
-#define MASK_74HC10 0x00000010
-#define MASK_74HC20 0x00000020
-#define MASK_74HC27 0x00000040
-#define MASK_74HC86 0x00000080
-// Bit field mask for setting a single bit for a specific test pass, one per IC
-
-typedef enum{IDLE, CHECK_74HC00, CHECK_74HC02, CHECK_74HC04, CHECK_74HC08, CHECK_74HC10,
-			 CHECK_74HC20, CHECK_74HC27, CHECK_74HC86, DISPLAY_RESULT} CONTROL_STATE_T;
-// Main test control state machine state enumerations
+// Result bit field with no test passed. Otherwise bit n is set for a pass of
+// the IC with designator n (bit n corresponds to ICLibrary[n], bit
+// NUM_LIBRARY_ICS + n corresponds to ICSequenceLibrary[n]).
 
-/******************************************************************************
-* Public Constants
-******************************************************************************/
-const IC_PARAMETERS_T IC_74HC00_PARAM = {IC_74HC00, 8, 4, {1, 2, 4, 5, 9, 10, 12, 13},
-										{3, 6, 8, 11} };
+#define MASK_ALL_ICS ((1UL << NUM_LIBRARY_ICS) - 1UL)
+// Bit field with a bit set for each IC in ICLibrary
+
+#define CHARACTERIZE_MODE TRUE
+// When TRUE, the propagation delay of every gate is measured after a single
+// IC passes
+
+#define DIAGNOSE_MODE TRUE
+// When TRUE, a failed test is followed by a fault diagnosis of every gate
+// of every library IC that passed the socket screen
+
+#define FIRST_PASS_MODE TRUE
+// When TRUE, testing stops once a candidate group or sequential IC passes.
+// Candidates are tried most identified first, so common parts are found
+// soonest.
+
+#define STOP_MODE TRUE
+// When TRUE, the MCU enters Stop mode between time slices while idle with
+// no LCD reprompt pending or button edge being debounced, woken by LPTIM1
+// for the next slice or by a button edge. Otherwise it only sleeps until
+// each SysTick interrupt.
+
+#define PER_MILLE_SCALE 1000ULL
+// Duty cycles are sent in parts per thousand of cycles
 
-const IC_PARAMETERS_T IC_74HC02_PARAM = {IC_74HC02, 8, 4, {2, 3, 5, 6, 8, 9, 11, 12},
-										{1, 4, 10, 13} };
+#define PRODUCTION_MODE FALSE
+// When TRUE, the socket is sensed every TIMESLICE_PERIOD_MS while idle. A
+// test starts by itself once an inserted IC is sensed, and the next one
+// only after it has been removed. The button still starts a test.
 
-const IC_PARAMETERS_T IC_74HC04_PARAM = {IC_74HC04, 6, 6, {1, 3, 5, 9, 11, 13},
-										{2, 4, 6, 8, 10, 12} };
+#define SENSE_STABLE_SLICES 15U
+// Time slices the sensed socket state must hold before an insertion or
+// removal is accepted (about 100 ms), so a part is not tested while it is
+// still being seated
 
-const IC_PARAMETERS_T IC_74HC08_PARAM = {IC_74HC08, 8, 4, {1, 2, 4, 5, 9, 10, 12, 13},
-										{3, 6, 8, 11} };
+#define MS_PER_HOUR 3600000ULL
+// Milliseconds per hour, for the parts per hour rate
 
-const IC_PARAMETERS_T IC_74HC10_PARAM = {IC_74HC10, 9, 3, {1, 2, 13, 3, 4, 5, 9, 10, 11},
-										{12, 6, 8} };
+#define SHMOO_MODE TRUE
+// When TRUE, a single passing library IC then has its vectors swept down
+// in settle delay, and a speed grade is displayed from the shortest delay
+// it passes at
 
-const IC_PARAMETERS_T IC_74HC20_PARAM = {IC_74HC20, 8, 2, {1, 2, 4, 5, 9, 10, 12, 13},
-										{6, 8} };
+#define GRADE_A_CYCLES 2
+#define GRADE_B_CYCLES 5
+// Longest passing settle delay (TIM22 cycles) for speed grades A and B.
+// ICs needing more, up to CYCLES_DELAY, are grade C, and ICs failing at
+// every delay grade F.
 
-const IC_PARAMETERS_T IC_74HC27_PARAM = {IC_74HC27, 9, 3, {1, 2, 13, 3, 4, 5, 9, 10, 11},
-										{12, 6, 8} };
+#define SOAK_MODE FALSE
+// When TRUE, a single passing library IC is then soaked: its vectors are
+// rerun until SOAK_PASSES passes or SOAK_SECONDS have elapsed, or the
+// button is pressed, and its fail rate is displayed
 
-const IC_PARAMETERS_T IC_74HC86_PARAM = {IC_74HC86, 8, 4, {1, 2, 4, 5, 9, 10, 12, 13},
-										{3, 6, 8, 11} };
-// 74HCXX Parameters: IC Designator, # of inputs, # of outputs, list of input pins,
-// and list of output pins
-// Note: Input lists shall have all input pin(s) for a certain gate grouped together,
-// and their corresponding output pin shall be placed accordingly in the output list
+#define SOAK_PASSES 100000UL
+#define SOAK_SECONDS 60UL
+// Soak limits, whichever is reached first ends the soak. A limit of 0 is
+// not used.
+
+#define SOAK_READS_PER_SLICE 64U
+// Vector reads run every TIMESLICE_PERIOD_MS while soaking, rounded down
+// to whole passes (at least one)
+
+#define PPM_SCALE 1000000ULL
+// Fail rates are shown in parts per million of vector reads
+
+#define LCD_COLUMNS 16
+// Characters per LCD line
+
+#define LCD_NAME_COLUMN (LCD_COLUMNS + 2U - IC_NAME_SIZE)
+// Column an IC name is shown at after a prompt, so the longest name ends
+// the first LCD line. Prompts before it must be LCD_NAME_COLUMN - 2
+// characters or less.
+
+#define LCD_GRADE_COLUMN 16
+// Column the speed grade is shown at, after a pass prompt
+
+typedef enum{IDLE, SCREEN, SCREEN_SEQUENCES, IDENTIFY, START_GROUP, CHECK_GROUP, START_SEQUENCE, CHECK_SEQUENCE, START_DIAGNOSE, DIAGNOSE, DISPLAY_RESULT, START_DELAY, MEASURE_DELAY, START_SHMOO, SHMOO, START_SOAK, SOAK} CONTROL_STATE_T;
+// Main test control state machine state enumerations
 
 /******************************************************************************
 * Public Constants
 ******************************************************************************/
 const uint8_t TestingPrompt[] = "Testing...";
 const uint8_t FailPrompt[] = "Test Fail";
-const uint8_t Pass74HC00Prompt[] = "74HC00 Passed";
-const uint8_t Pass74HC02Prompt[] = "74HC02 Passed";
-const uint8_t Pass74HC04Prompt[] = "74HC04 Passed";
-const uint8_t Pass74HC08Prompt[] = "74HC08 Passed";
-const uint8_t Pass74HC10Prompt[] = "74HC10 Passed";
-const uint8_t Pass74HC20Prompt[] = "74HC20 Passed";
-const uint8_t Pass74HC27Prompt[] = "74HC27 Passed";
-const uint8_t Pass74HC86Prompt[] = "74HC86 Passed";
 const uint8_t MultiPrompt[] = "Multipass Error";
 // String to be displayed at the end of each test as well as when in the middle
 // of testing.
 
+const uint8_t TpdPrompt[] = "tpd";
+const uint8_t TpdGatePrompt[] = " G";
+const uint8_t TpdNonePrompt[] = "-";
+const uint8_t TpdUnitPrompt[] = " ns\r\n";
+// Strings used to build propagation delay lines. Gates that can not be
+// measured are shown as TpdNonePrompt.
+
+const uint8_t NoICPrompt[] = "No IC Found";
+const uint8_t InsertionPrompt[] = "Check Insertion";
+const uint8_t ShortPrompt[] = "Short";
+const uint8_t OpenPrompt[] = "Open";
+// Strings shown when the socket screen fails, followed on the second line
+// by the socket pins at fault
+
+const uint8_t GateFaultPrompts[][13] = {[GATE_OK] = "ok",
+										[GATE_STUCK_0] = "stuck-0",
+										[GATE_STUCK_1] = "stuck-1",
+										[GATE_INCONSISTENT] = "inconsistent"};
+const uint8_t DiagFaultyPrompt[] = "Faulty";
+const uint8_t DiagGatePrompt[] = " G";
+const uint8_t DiagSeparatorPrompt[] = ":";
+const uint8_t DiagSpacePrompt[] = " ";
+const uint8_t DiagMorePrompt[] = " +";
+const uint8_t DiagEndPrompt[] = "\r\n";
+// Strings used to build fault diagnosis lines. DiagFaultyPrompt is shown
+// before the closest candidate's name.
+
+const uint8_t DutyPrompt[] = "duty active:";
+const uint8_t DutySleepPrompt[] = " sleep:";
+const uint8_t DutyUnitPrompt[] = " kcycles ";
+const uint8_t DutyScalePrompt[] = "/1000\r\n";
+// Strings used to build the duty cycle line
+
+const uint8_t SettlePrompt[] = "settle reads:";
+const uint8_t SettleSamplesPrompt[] = " samples:";
+const uint8_t SettleTimeoutsPrompt[] = " timeouts:";
+const uint8_t SettleMaxPrompt[] = " max:";
+const uint8_t SettleEndPrompt[] = "\r\n";
+// Strings used to build the settle statistics line
+
+const uint8_t PartsHourPrompt[] = " parts/hr";
+// Shown after the parts per hour rate in PRODUCTION_MODE
+
+const uint8_t GradePrompts[][2] = {"A", "B", "C", "F"};
+const uint8_t GradeUartPrompt[] = " settle min:";
+const uint8_t GradeSeparatorPrompt[] = " grade:";
+// Speed grade letters from best to failing, and strings used to build the
+// settle sweep line
+
+const uint8_t SoakingPrompt[] = "Soaking...";
+const uint8_t SoakPassPrompt[] = "Soak OK";
+const uint8_t SoakFailPrompt[] = "Soak Bad";
+const uint8_t SoakPpmPrompt[] = " ppm";
+const uint8_t SoakReadsPrompt[] = " n=";
+const uint8_t SoakUartPrompt[] = " soak passes:";
+const uint8_t SoakFailedPrompt[] = " failed:";
+const uint8_t SoakRatePrompt[] = " ppm:";
+const uint8_t SoakVectorPrompt[] = " V";
+// Strings used to build soak result lines
+
 /******************************************************************************
 * Public Function Prototypes
 ******************************************************************************/
 void ControlTask(void);
+uint8_t MostUsedIndex(uint32_t, uint8_t);
 void DisplayResult(uint32_t);
+void DisplayTpd(const uint16_t *, uint8_t);
+void DisplayScreen(const CHECKER_SCREEN_T *);
+void DisplayFaults(uint8_t, const GATE_DIAG_T *);
+void SendDiagnosis(uint8_t, const GATE_DIAG_T *, uint8_t);
+void SendDuty(const SYSTICK_CYCLES_T *, const SYSTICK_CYCLES_T *);
+void SendSettle(const CHECKER_SETTLE_STATS_T *, const CHECKER_SETTLE_STATS_T *);
+void DisplayPartsHour(uint32_t, uint32_t);
+void DisplayGrade(uint8_t, uint8_t);
+void DisplaySoak(uint8_t, const CHECKER_SOAK_T *);
+uint8_t NumToString(uint32_t, uint8_t *);
+void HexToString(uint16_t, uint8_t *);
+uint8_t AppendString(uint8_t *, uint8_t, const uint8_t *);
 
 int main(void)
 {
@@ -112,12 +338,14 @@ int main(void)
 	CheckerInit();
 	I2CInit();
 	LCDInit();
+	UARTInit();
+	UsageInit();
 	// Super loop - executes loop every TIMESLICE_PERIOD_MS
 	while(1)
 	{
 		SysTickWaitTask(TIMESLICE_PERIOD_MS);
-		ButtonDBReadTask();
 		ControlTask();
+		UsageWriteTask();
 	}
 }
 
@@ -126,10 +354,60 @@ int main(void)
 *
 * Description:  Main control state machine structure. Enters every
 * 				TIMESLICE_PERIOD_MS. Resets to IDLE state, where
-* 				button state is polled until an asserted value is read.
-* 				Task then cycles through all given testing designators.
-* 				One test is performed every TIMESLICE_PERIOD_MS. If a test
-* 				is passed
+* 				latched button press is polled until a press is read.
+* 				With STOP_MODE, Stop mode is allowed between slices
+* 				while IDLE, with no LCD reprompt pending and the button
+* 				not being debounced. Each test start sends the duty
+* 				cycle since the last one, and each result the settle
+* 				statistics of the test's reads. With PRODUCTION_MODE,
+* 				IDLE also senses the socket, and a test starts once an
+* 				IC has been sensed for SENSE_STABLE_SLICES after the
+* 				socket was sensed empty. Each removal updates the parts
+* 				per hour rate, taken over the test starts so far. The
+* 				IC's package is first sensed with the socket unpowered,
+* 				and only that package is ever powered. If none is
+* 				sensed, NoICPrompt is displayed. Socket pins of the
+* 				package are then screened for opens and shorts, and if
+* 				no IC passes, the closest screen is displayed without
+* 				further testing. Sequential ICs are screened in the
+* 				next slice. Task then walks the decision tree, if the
+* 				package is the tree's, to narrow the library down to a
+* 				few candidates. These are then fully tested, one group
+* 				of candidates sharing the same input pins at a time,
+* 				the group of the most identified candidate first. Each
+* 				group test is run in steps, one per
+* 				TIMESLICE_PERIOD_MS, of at most CHECKER_STEP_VECTORS
+* 				vectors or one output stage check (see
+* 				CheckerStepGroup), so no slice runs over however many
+* 				vectors a group needs. Sequential ICs that passed the
+* 				screen are then run through their test sequences, most
+* 				identified first, one step of at most
+* 				CHECKER_STEP_VECTORS sequence steps per
+* 				TIMESLICE_PERIOD_MS (see CheckerStepSequence). Each
+* 				passing IC sets its bit in the result field, which is
+* 				then displayed. With FIRST_PASS_MODE, testing stops
+* 				after the first group or sequence that passes. A single
+* 				passing IC is counted as identified. With
+* 				DIAGNOSE_MODE, a failed test first diagnoses every
+* 				library IC that passed the screen, one step of at most
+* 				CHECKER_STEP_VECTORS vectors per TIMESLICE_PERIOD_MS
+* 				(see CheckerStepDiagnosis), keeping the IC with the
+* 				fewest faulty gates for display. The tree assumes a
+* 				working IC, so a faulty one may not reach its own leaf.
+* 				An IC whose every gate is faulty is not kept, nor is
+* 				one with no faulty gate, as its failure lies in its
+* 				output stage rather than its logic. With
+* 				CHARACTERIZE_MODE, a single passing IC then has the
+* 				propagation delay of its gates measured, one gate per
+* 				TIMESLICE_PERIOD_MS (see CheckerStepTpd), and
+* 				displayed. With SHMOO_MODE, it then has its settle
+* 				delay swept, one step of at most CHECKER_STEP_VECTORS
+* 				vector reads per TIMESLICE_PERIOD_MS (see
+* 				CheckerStepShmoo), and its speed grade displayed. With
+* 				SOAK_MODE, a single passing library IC is then soaked,
+* 				running SOAK_READS_PER_SLICE vector reads every
+* 				TIMESLICE_PERIOD_MS until a soak limit is reached or
+* 				the button is pressed, and its fail rate is displayed.
 *
 * Return value:	none
 *
@@ -139,71 +417,344 @@ void ControlTask(void)
 {
 	static CONTROL_STATE_T control_state= IDLE;
 	static uint32_t result_field = 0x00000000;
+	static uint32_t pending_field = 0x00000000;
+	static uint32_t screen_field = 0x00000000;
+	static uint32_t sequence_field = 0x00000000;
+	static uint32_t diag_field = 0x00000000;
+	static uint8_t screen_package = CHECKER_PACKAGE_NONE;
+	static CHECKER_SCREEN_T screen;
+	static GATE_DIAG_T diag_gates[CHECKER_MAX_GATES];
+	static GATE_DIAG_T gate_diags[CHECKER_MAX_GATES];
+	static uint8_t diag_index = 0;
+	static uint8_t diag_faulty = CHECKER_DIAG_NONE;
+	static CHECKER_DIAG_T diag;
+	static uint16_t tpd_ns[CHECKER_MAX_GATES];
+	static CHECKER_TPD_T tpd;
+	static CHECKER_GROUP_T group;
+	static CHECKER_SEQUENCE_T sequence;
+	static CHECKER_SHMOO_T shmoo;
+	static CHECKER_SOAK_T soak;
+	static uint32_t soak_start_ms = 0;
+	static uint8_t soak_index = 0;
+	static uint8_t socket_loaded = FALSE;
+	static uint8_t sense_slices = 0;
+	static uint32_t num_parts = 0;
+	static uint32_t first_part_ms = 0;
+	static uint32_t last_part_ms = 0;
+	static SYSTICK_CYCLES_T last_cycles;
+	static CHECKER_SETTLE_STATS_T start_settle;
+	SYSTICK_CYCLES_T cycles;
+	uint8_t start_test;
+	uint32_t group_field;
+	uint8_t ic_index;
+	uint8_t num_faulty;
+	uint16_t num_passes;
 
 	switch(control_state){
 		case IDLE:
-			if(ButtonGet() == PRESSED)
+			start_test = (ButtonGet() == PRESSED) ? TRUE : FALSE;
+			if(PRODUCTION_MODE == TRUE)
 			{
+				sense_slices = (CheckerSenseSocket() == socket_loaded) ? 0 : (sense_slices + 1U);
+				if(sense_slices >= SENSE_STABLE_SLICES)
+				{
+					socket_loaded = !socket_loaded;
+					sense_slices = 0;
+					if(socket_loaded == TRUE)
+					{
+						start_test = TRUE;
+					} else
+					{
+						DisplayPartsHour(num_parts, last_part_ms - first_part_ms);
+					}
+				}
+			}
+
+			if(start_test == TRUE)
+			{
+				last_part_ms = SysTickGetCount();
+				if(num_parts == 0) first_part_ms = last_part_ms;
+				num_parts++;
+				SysTickGetCycles(&cycles);
+				SendDuty(&last_cycles, &cycles);
+				last_cycles = cycles;
+				start_settle = *CheckerSettleStats();
 				LCDClearDisplay();
 				LCDMoveCursor(1U,1U);
 				LCDDisplayString(TestingPrompt);
-				control_state = CHECK_74HC00;
+				control_state = SCREEN;
+			} else
+			{
+				control_state = IDLE;
+			}
+			break;
+
+		case SCREEN:
+			screen_package = CheckerSensePackage();
+			screen_field = 0x00000000;
+			sequence_field = 0x00000000;
+			screen.driven_field = 0x00000000;
+			if(CheckerSelectPackage(screen_package) == PASSED)
+			{
+				screen_field = CheckerScreenSocket(ICLibrary, NUM_LIBRARY_ICS, &screen);
+				control_state = SCREEN_SEQUENCES;
 			} else
 			{
+				DisplayScreen(&screen);
 				control_state = IDLE;
 			}
 			break;
 
-		case CHECK_74HC00:
-			if(CheckerTestIC(IC_74HC00_PARAM) == PASSED) result_field |= MASK_74HC00;
-			control_state = CHECK_74HC02;
+		case SCREEN_SEQUENCES:
+			sequence_field = CheckerScreenSequences(ICSequenceLibrary, NUM_SEQUENCE_ICS, &screen);
+
+			if((screen_field | sequence_field) != 0)
+			{
+				control_state = IDENTIFY;
+			} else
+			{
+				DisplayScreen(&screen);
+				control_state = IDLE;
+			}
 			break;
 
-		case CHECK_74HC02:
-			if(CheckerTestIC(IC_74HC02_PARAM) == PASSED) result_field |= MASK_74HC02;
-			control_state = CHECK_74HC04;
+		case IDENTIFY:
+			pending_field = (screen_field & ~IC_TREE_CANDIDATES);
+			if((screen_field & IC_TREE_CANDIDATES) != 0)
+			{
+				pending_field |= (CheckerWalkTree(ICTree, ICTreeLeaves, IC_TREE_ROOT, screen.driven_field) & screen_field);
+			}
+
+			diag_field = screen_field;
+			control_state = (pending_field != 0) ? START_GROUP : START_SEQUENCE;
 			break;
 
-		case CHECK_74HC04:
-			if(CheckerTestIC(IC_74HC04_PARAM) == PASSED) result_field |= MASK_74HC04;
-			control_state = CHECK_74HC08;
+		case START_GROUP:
+			ic_index = MostUsedIndex(pending_field, 0);
+
+			group_field = (CheckerGroupField(ICLibrary, NUM_LIBRARY_ICS, ic_index) & pending_field);
+			CheckerStartGroup(ICLibrary, NUM_LIBRARY_ICS, group_field, &group);
+			pending_field &= ~group_field;
+
+			control_state = CHECK_GROUP;
 			break;
 
-		case CHECK_74HC08:
-			if(CheckerTestIC(IC_74HC08_PARAM) == PASSED) result_field |= MASK_74HC08;
-			control_state = CHECK_74HC10;
+		case CHECK_GROUP:
+			if(CheckerStepGroup(&group) == TRUE)
+			{
+				result_field |= group.live_field;
+				if((FIRST_PASS_MODE == TRUE) && (group.live_field != 0))
+				{
+					pending_field = 0x00000000;
+					sequence_field = 0x00000000;
+				}
+				control_state = (pending_field != 0) ? START_GROUP : START_SEQUENCE;
+			}
 			break;
 
-		case CHECK_74HC10:
-			if(CheckerTestIC(IC_74HC10_PARAM) == PASSED) result_field |= MASK_74HC10;
-			control_state = CHECK_74HC20;
+		case START_SEQUENCE:
+			if(sequence_field != 0)
+			{
+				ic_index = MostUsedIndex(sequence_field, NUM_LIBRARY_ICS);
+				CheckerStartSequence(&ICSequenceLibrary[ic_index], &sequence);
+				control_state = CHECK_SEQUENCE;
+			} else
+			{
+				control_state = ((DIAGNOSE_MODE == TRUE) && (result_field == 0) && (diag_field != 0)) ? START_DIAGNOSE : DISPLAY_RESULT;
+			}
 			break;
 
-		case CHECK_74HC20:
-			if(CheckerTestIC(IC_74HC20_PARAM) == PASSED) result_field |= MASK_74HC20;
-			control_state = CHECK_74HC27;
+		case CHECK_SEQUENCE:
+			if(CheckerStepSequence(&sequence) == TRUE)
+			{
+				ic_index = MostUsedIndex(sequence_field, NUM_LIBRARY_ICS);
+
+				if(sequence.result == PASSED)
+				{
+					result_field |= (1UL << (NUM_LIBRARY_ICS + ic_index));
+					if(FIRST_PASS_MODE == TRUE) sequence_field = 0x00000000;
+				}
+				sequence_field &= ~(1UL << ic_index);
+				control_state = START_SEQUENCE;
+			}
 			break;
 
-		case CHECK_74HC27:
-			if(CheckerTestIC(IC_74HC27_PARAM) == PASSED) result_field |= MASK_74HC27;
-			control_state = CHECK_74HC86;
+		case START_DIAGNOSE:
+			ic_index = 0;
+			while(((diag_field >> ic_index) & 0x01) == 0) ic_index++;
+
+			CheckerStartDiagnosis(&ICLibrary[ic_index], gate_diags, &diag);
+			control_state = DIAGNOSE;
 			break;
 
-		case CHECK_74HC86:
-			if(CheckerTestIC(IC_74HC86_PARAM) == PASSED) result_field |= MASK_74HC86;
-			control_state = DISPLAY_RESULT;
+		case DIAGNOSE:
+			if(CheckerStepDiagnosis(&diag) == TRUE)
+			{
+				ic_index = 0;
+				while(((diag_field >> ic_index) & 0x01) == 0) ic_index++;
+
+				num_faulty = diag.num_faulty;
+				SendDiagnosis(ic_index, gate_diags, num_faulty);
+
+				if((num_faulty != 0) && (num_faulty < diag_faulty) && (num_faulty < ICLibrary[ic_index].num_outputs))
+				{
+					diag_faulty = num_faulty;
+					diag_index = ic_index;
+					for(uint8_t gate_num = 0; gate_num < CHECKER_MAX_GATES; gate_num++)
+					{
+						diag_gates[gate_num] = gate_diags[gate_num];
+					}
+				}
+				diag_field &= ~(1UL << ic_index);
+
+				control_state = (diag_field != 0) ? START_DIAGNOSE : DISPLAY_RESULT;
+			}
 			break;
 
 		case DISPLAY_RESULT:
 			DisplayResult(result_field);
+			SendSettle(&start_settle, CheckerSettleStats());
+			if((result_field != MASK_FAILURE) && ((result_field & (result_field - 1UL)) == 0))
+			{
+				ic_index = 0;
+				while(((result_field >> ic_index) & 0x01) == 0) ic_index++;
+				UsageCount(ic_index);
+			}
+			if(diag_faulty != CHECKER_DIAG_NONE)
+			{
+				DisplayFaults(diag_index, diag_gates);
+				diag_faulty = CHECKER_DIAG_NONE;
+			}
+			if(((CHARACTERIZE_MODE == TRUE) || (SHMOO_MODE == TRUE) || (SOAK_MODE == TRUE)) &&
+			   ((result_field & MASK_ALL_ICS) != 0) && ((result_field & (result_field - 1UL)) == 0))
+			{
+				control_state = START_DELAY;
+			} else
+			{
+				result_field = 0x00000000;
+				control_state = IDLE;
+			}
+			break;
+
+		case START_DELAY:
+			ic_index = 0;
+			while(((result_field >> ic_index) & 0x01) == 0) ic_index++;
+
+			control_state = START_SHMOO;
+			if(CHARACTERIZE_MODE == TRUE)
+			{
+				CheckerStartTpd(&ICLibrary[ic_index], tpd_ns, &tpd);
+				control_state = MEASURE_DELAY;
+			}
+			break;
+
+		case MEASURE_DELAY:
+			if(CheckerStepTpd(&tpd) == TRUE)
+			{
+				DisplayTpd(tpd_ns, tpd.num_gates);
+				control_state = START_SHMOO;
+			}
+			break;
+
+		case START_SHMOO:
+			ic_index = 0;
+			while(((result_field >> ic_index) & 0x01) == 0) ic_index++;
+
+			control_state = START_SOAK;
+			if(SHMOO_MODE == TRUE)
+			{
+				CheckerStartShmoo(&ICLibrary[ic_index], &shmoo);
+				control_state = SHMOO;
+			}
+			break;
+
+		case SHMOO:
+			if(CheckerStepShmoo(&shmoo) == TRUE)
+			{
+				ic_index = 0;
+				while(((result_field >> ic_index) & 0x01) == 0) ic_index++;
+
+				DisplayGrade(ic_index, shmoo.min_cycles);
+				control_state = START_SOAK;
+			}
+			break;
+
+		case START_SOAK:
+			ic_index = 0;
+			while(((result_field >> ic_index) & 0x01) == 0) ic_index++;
+
 			result_field = 0x00000000;
 			control_state = IDLE;
+			if((SOAK_MODE == TRUE) && (CheckerStartSoak(&ICLibrary[ic_index], &soak) == PASSED))
+			{
+				LCDClearDisplay();
+				LCDMoveCursor(1U,1U);
+				LCDDisplayString(SoakingPrompt);
+				soak_index = ic_index;
+				soak_start_ms = SysTickGetCount();
+				control_state = SOAK;
+			}
+			break;
+
+		case SOAK:
+			num_passes = SOAK_READS_PER_SLICE/soak.num_vectors;
+			if(num_passes == 0) num_passes = 1;
+			if((SOAK_PASSES != 0) && (num_passes > (SOAK_PASSES - soak.num_passes)))
+			{
+				num_passes = SOAK_PASSES - soak.num_passes;
+			}
+			CheckerRunSoak(&soak, num_passes);
+
+			if(((SOAK_PASSES != 0) && (soak.num_passes >= SOAK_PASSES)) ||
+			   ((SOAK_SECONDS != 0) && ((SysTickGetCount() - soak_start_ms) >= (SOAK_SECONDS*1000UL))) ||
+			   (ButtonGet() == PRESSED))
+			{
+				DisplaySoak(soak_index, &soak);
+				control_state = IDLE;
+			}
 			break;
 
 		default:
 			result_field = 0x00000000;
 			break;
 	}
+
+	SysTickAllowStop(((STOP_MODE == TRUE) && (control_state == IDLE) &&
+					 (LCDRepromptPending() == 0) && (ButtonDebouncing() == 0)) ? TRUE : FALSE);
+}
+
+/********************************************************************
+* MostUsedIndex - Picks the most identified IC of a bit field
+*
+* Description:  Ties go to the lowest index, so with no uses counted
+* 				ICs are picked in library order.
+*
+* Return value:	Bit index of the IC with the highest usage count
+*
+* Arguments:    uint32_t ic_field - Bit field of ICs to pick from (not
+* 				0)
+*
+* 				uint8_t first_designator - Designator of the IC at bit
+* 				0 (0 for ICLibrary, NUM_LIBRARY_ICS for
+* 				ICSequenceLibrary)
+********************************************************************/
+uint8_t MostUsedIndex(uint32_t ic_field, uint8_t first_designator)
+{
+	uint8_t most_index = 0;
+	uint16_t most_uses;
+
+	while(((ic_field >> most_index) & 0x01) == 0) most_index++;
+	most_uses = UsageGet(first_designator + most_index);
+
+	for(uint8_t ic_index = most_index + 1U; ic_index < 32U; ic_index++)
+	{
+		if((((ic_field >> ic_index) & 0x01) != 0) && (UsageGet(first_designator + ic_index) > most_uses))
+		{
+			most_index = ic_index;
+			most_uses = UsageGet(first_designator + ic_index);
+		}
+	}
+	return most_index;
 }
 
 /********************************************************************
@@ -213,7 +764,8 @@ void ControlTask(void)
 * 				function to determine which prompt to display to the
 * 				user. The display will clear and the cursor will return
 * 				to the home position (1,1). The prompt will display for
-* 				LCD_REPROMPT_DELAY_SECONDS located in LCD.h.
+* 				LCD_REPROMPT_DELAY_SECONDS located in LCD.h. A single
+* 				passing IC is shown with its prompt from ICPassPrompts.
 *
 * Return value:	none
 *
@@ -222,66 +774,582 @@ void ControlTask(void)
 ********************************************************************/
 void DisplayResult(uint32_t result_field)
 {
-	switch(result_field)
+	uint8_t ic_index = 0;
+
+	LCDClearDisplay();
+	LCDMoveCursor(1U,1U);
+
+	if(result_field == MASK_FAILURE)
 	{
-		case MASK_FAILURE:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(FailPrompt);
-			break;
+		LCDDisplayString(FailPrompt);
+	} else if((result_field & (result_field - 1UL)) != 0)
+	{
+		LCDDisplayString(MultiPrompt);
+	} else
+	{
+		while((result_field >> ic_index) != 1UL)
+		{
+			ic_index++;
+		}
+		LCDDisplayString(ICPassPrompts[ic_index]);
+	}
+}
 
-		case MASK_74HC00:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC00Prompt);
-			break;
+/********************************************************************
+* DisplayTpd - Function for showing gate propagation delays
+*
+* Description:  Builds a line of the measured delay of each gate in
+* 				nanoseconds, with TpdNonePrompt for gates that could
+* 				not be measured. As many gates as fit are displayed on
+* 				the second LCD line, under the result prompt. Every
+* 				gate is sent over the UART debug link, numbered from
+* 				G1.
+*
+* Return value:	none
+*
+* Arguments:    const uint16_t *tpd_ns - Array of gate delays from
+* 				CheckerStepTpd
+*
+* 				uint8_t num_gates - Number of gates in tpd_ns
+********************************************************************/
+void DisplayTpd(const uint16_t *tpd_ns, uint8_t num_gates)
+{
+	uint8_t lcd_line[LCD_COLUMNS + 1];
+	uint8_t lcd_length = 0;
+	uint8_t value_string[6];
+	uint8_t value_length;
+	uint8_t gate_string[3] = {'1', ':', '\0'};
 
-		case MASK_74HC02:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC02Prompt);
-			break;
+	while(TpdPrompt[lcd_length] != '\0')
+	{
+		lcd_line[lcd_length] = TpdPrompt[lcd_length];
+		lcd_length++;
+	}
+	lcd_line[lcd_length] = '\0';
 
-		case MASK_74HC04:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC04Prompt);;
-			break;
+	UARTTxString(TpdPrompt);
 
-		case MASK_74HC08:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC08Prompt);
-			break;
+	for(uint8_t gate_num = 0; gate_num < num_gates; gate_num++)
+	{
+		if(tpd_ns[gate_num] == CHECKER_TPD_NONE)
+		{
+			value_string[0] = TpdNonePrompt[0];
+			value_string[1] = '\0';
+			value_length = 1;
+		} else
+		{
+			value_length = NumToString(tpd_ns[gate_num], value_string);
+		}
 
-		case MASK_74HC10:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC10Prompt);
-			break;
+		UARTTxString(TpdGatePrompt);
+		UARTTxString(gate_string);
+		UARTTxString(value_string);
+		gate_string[0]++;
 
-		case MASK_74HC20:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC20Prompt);
-			break;
+		if((lcd_length + 1U + value_length) <= LCD_COLUMNS)
+		{
+			lcd_line[lcd_length++] = ' ';
+			for(uint8_t char_num = 0; char_num < value_length; char_num++)
+			{
+				lcd_line[lcd_length++] = value_string[char_num];
+			}
+			lcd_line[lcd_length] = '\0';
+		}
+	}
 
-		case MASK_74HC27:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC27Prompt);
-			break;
+	UARTTxString(TpdUnitPrompt);
 
-		case MASK_74HC86:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(Pass74HC86Prompt);
-			break;
+	LCDMoveCursor(1U,2U);
+	LCDDisplayString(lcd_line);
+}
 
-		default:
-			LCDClearDisplay();
-			LCDMoveCursor(1U,1U);
-			LCDDisplayString(MultiPrompt);
-			break;
+/********************************************************************
+* DisplayScreen - Function for showing a failed socket screen
+*
+* Description:  If no package pin was driven, the socket is empty (or
+* 				no package was sensed) and NoICPrompt is shown.
+* 				Otherwise InsertionPrompt is shown, with the pins at
+* 				fault on the second line. Shorted pins and input pins
+* 				of the closest IC that were driven (shorted to another
+* 				pin or a supply, which pulls can not tell apart) are
+* 				shown first, otherwise its output pins that were not
+* 				driven (e.g. "Open 6 11"). Pins are listed as long as
+* 				they fit.
+*
+* Return value:	none
+*
+* Arguments:    const CHECKER_SCREEN_T *screen - Screen result from
+* 				CheckerScreenSocket
+********************************************************************/
+void DisplayScreen(const CHECKER_SCREEN_T *screen)
+{
+	uint8_t lcd_line[LCD_COLUMNS + 1] = {'\0'};
+	uint8_t lcd_length = 0;
+	uint8_t value_string[6];
+	PIN_FIELD_T pin_field;
+
+	LCDClearDisplay();
+	LCDMoveCursor(1U,1U);
+
+	if(screen->driven_field == 0)
+	{
+		LCDDisplayString(NoICPrompt);
+		return;
+	}
+	LCDDisplayString(InsertionPrompt);
+
+	if((screen->short_field | screen->stuck_field) != 0)
+	{
+		lcd_length = AppendString(lcd_line, lcd_length, ShortPrompt);
+		pin_field = (screen->short_field | screen->stuck_field);
+	} else
+	{
+		lcd_length = AppendString(lcd_line, lcd_length, OpenPrompt);
+		pin_field = screen->open_field;
+	}
+
+	for(uint8_t ic_pin = 1; ic_pin <= CHECKER_MAX_PINS; ic_pin++)
+	{
+		if(((pin_field >> ic_pin) & 0x01) == 0) continue;
+
+		NumToString(ic_pin, value_string);
+		lcd_length = AppendString(lcd_line, lcd_length, DiagSpacePrompt);
+		lcd_length = AppendString(lcd_line, lcd_length, value_string);
+	}
+
+	LCDMoveCursor(1U,2U);
+	LCDDisplayString(lcd_line);
+}
+
+/********************************************************************
+* DisplayFaults - Function for showing the closest candidate's faults
+*
+* Description:  Replaces the fail prompt with DiagFaultyPrompt and the
+* 				candidate's name, and shows its first faulty gate with
+* 				fault type on the second LCD line (e.g. "G2 stuck-0").
+* 				If more gates are faulty, their count is added when it
+* 				fits (e.g. "G2 stuck-0 +1").
+*
+* Return value:	none
+*
+* Arguments:    uint8_t ic_index - Library index of candidate
+*
+* 				const GATE_DIAG_T *gate_diags - Array of gate
+* 				diagnoses from CheckerStepDiagnosis
+********************************************************************/
+void DisplayFaults(uint8_t ic_index, const GATE_DIAG_T *gate_diags)
+{
+	uint8_t lcd_line[LCD_COLUMNS + 1] = {'\0'};
+	uint8_t lcd_length = 0;
+	uint8_t value_string[6];
+	uint8_t num_more = 0;
+
+	for(uint8_t gate_num = 0; gate_num < ICLibrary[ic_index].num_outputs; gate_num++)
+	{
+		if(gate_diags[gate_num].fault == GATE_OK) continue;
+
+		if(lcd_length == 0)
+		{
+			NumToString(gate_num + 1U, value_string);
+			lcd_length = AppendString(lcd_line, lcd_length, &DiagGatePrompt[1]);
+			lcd_length = AppendString(lcd_line, lcd_length, value_string);
+			lcd_length = AppendString(lcd_line, lcd_length, DiagSpacePrompt);
+			lcd_length = AppendString(lcd_line, lcd_length, GateFaultPrompts[gate_diags[gate_num].fault]);
+		} else
+		{
+			num_more++;
+		}
+	}
+
+	if(num_more > 0)
+	{
+		NumToString(num_more, value_string);
+		lcd_length = AppendString(lcd_line, lcd_length, DiagMorePrompt);
+		lcd_length = AppendString(lcd_line, lcd_length, value_string);
+	}
+
+	LCDClearDisplay();
+	LCDMoveCursor(1U,1U);
+	LCDDisplayString(DiagFaultyPrompt);
+	LCDMoveCursor(LCD_NAME_COLUMN,1U);
+	LCDDisplayString(ICNamePrompts[ic_index]);
+	LCDMoveCursor(1U,2U);
+	LCDDisplayString(lcd_line);
+}
+
+/********************************************************************
+* SendDiagnosis - Sends a candidate's fault map over the debug link
+*
+* Description:  Sends one line with the candidate's name followed by
+* 				every gate and its fault type, numbered from G1. Faulty
+* 				gates are followed by their mismatch bit field in hex
+* 				(bit n set if gate input combination n read wrong),
+* 				e.g. "74HC00 G1:ok G2:stuck-0:000E G3:ok G4:ok". A
+* 				candidate whose pins can not be tested only has its
+* 				name sent.
+*
+* Return value:	none
+*
+* Arguments:    uint8_t ic_index - Library index of candidate
+*
+* 				const GATE_DIAG_T *gate_diags - Array of gate
+* 				diagnoses from CheckerStepDiagnosis
+*
+* 				uint8_t num_faulty - Faulty gates left by
+* 				CheckerStepDiagnosis
+********************************************************************/
+void SendDiagnosis(uint8_t ic_index, const GATE_DIAG_T *gate_diags, uint8_t num_faulty)
+{
+	uint8_t value_string[6];
+
+	UARTTxString(ICNamePrompts[ic_index]);
+
+	for(uint8_t gate_num = 0; (num_faulty != CHECKER_DIAG_NONE) && (gate_num < ICLibrary[ic_index].num_outputs); gate_num++)
+	{
+		NumToString(gate_num + 1U, value_string);
+		UARTTxString(DiagGatePrompt);
+		UARTTxString(value_string);
+		UARTTxString(DiagSeparatorPrompt);
+		UARTTxString(GateFaultPrompts[gate_diags[gate_num].fault]);
+
+		if(gate_diags[gate_num].fault != GATE_OK)
+		{
+			HexToString(gate_diags[gate_num].mismatch_field, value_string);
+			UARTTxString(DiagSeparatorPrompt);
+			UARTTxString(value_string);
+		}
+	}
+
+	UARTTxString(DiagEndPrompt);
+}
+
+/********************************************************************
+* DisplayPartsHour - Function for showing production throughput
+*
+* Description:  The rate is taken over the intervals between test
+* 				starts, num_parts - 1 of them spanning elapsed_ms, and
+* 				shown on the second LCD line under the last result
+* 				(e.g. "412 parts/hr"). Nothing is shown until two
+* 				parts have been tested.
+*
+* Return value:	none
+*
+* Arguments:    uint32_t num_parts - Parts tested so far
+*
+* 				uint32_t elapsed_ms - Milliseconds from the first test
+* 				start to the last
+********************************************************************/
+void DisplayPartsHour(uint32_t num_parts, uint32_t elapsed_ms)
+{
+	uint8_t lcd_line[LCD_COLUMNS + 1] = {'\0'};
+	uint8_t lcd_length = 0;
+	uint8_t value_string[11];
+
+	if((num_parts < 2U) || (elapsed_ms == 0)) return;
+
+	NumToString((uint32_t)(((num_parts - 1UL)*MS_PER_HOUR)/elapsed_ms), value_string);
+	lcd_length = AppendString(lcd_line, lcd_length, value_string);
+	lcd_length = AppendString(lcd_line, lcd_length, PartsHourPrompt);
+
+	LCDMoveCursor(1U,2U);
+	LCDDisplayString(lcd_line);
+}
+
+/********************************************************************
+* SendDuty - Function for sending the duty cycle
+*
+* Description:  Active and sleeping cycles between two fetches of
+* 				SysTickGetCycles are sent over the UART debug link in
+* 				thousands, with the active share of all cycles in parts
+* 				per thousand (e.g. "duty active:1200 sleep:60000
+* 				kcycles 19/1000").
+*
+* Return value:	none
+*
+* Arguments:    const SYSTICK_CYCLES_T *start - Cycle counts at start
+* 				of span
+*
+* 				const SYSTICK_CYCLES_T *end - Cycle counts at end of
+* 				span
+********************************************************************/
+void SendDuty(const SYSTICK_CYCLES_T *start, const SYSTICK_CYCLES_T *end)
+{
+	uint8_t value_string[11];
+	uint64_t active_cycles = end->active_cycles - start->active_cycles;
+	uint64_t sleep_cycles = end->sleep_cycles - start->sleep_cycles;
+	uint32_t per_mille = 0;
+
+	if((active_cycles + sleep_cycles) != 0)
+	{
+		per_mille = (uint32_t)((active_cycles*PER_MILLE_SCALE)/(active_cycles + sleep_cycles));
+	}
+
+	UARTTxString(DutyPrompt);
+	NumToString((uint32_t)(active_cycles/1000U), value_string);
+	UARTTxString(value_string);
+	UARTTxString(DutySleepPrompt);
+	NumToString((uint32_t)(sleep_cycles/1000U), value_string);
+	UARTTxString(value_string);
+	UARTTxString(DutyUnitPrompt);
+	NumToString(per_mille, value_string);
+	UARTTxString(value_string);
+	UARTTxString(DutyScalePrompt);
+}
+
+/********************************************************************
+* SendSettle - Function for sending output read settle statistics
+*
+* Description:  Output reads between two fetches of
+* 				CheckerSettleStats are sent over the UART debug link,
+* 				with the port samples they needed in all, the reads that
+* 				timed out, and the most samples any read has needed
+* 				since reset (e.g. "settle reads:40 samples:124
+* 				timeouts:0 max:5"). Samples over reads is the average a
+* 				read needed, which tracks the propagation delay of the
+* 				IC in the socket.
+*
+* Return value:	none
+*
+* Arguments:    const CHECKER_SETTLE_STATS_T *start - Statistics at
+* 				start of span
+*
+* 				const CHECKER_SETTLE_STATS_T *end - Statistics at end
+* 				of span
+********************************************************************/
+void SendSettle(const CHECKER_SETTLE_STATS_T *start, const CHECKER_SETTLE_STATS_T *end)
+{
+	uint8_t value_string[11];
+
+	UARTTxString(SettlePrompt);
+	NumToString(end->num_reads - start->num_reads, value_string);
+	UARTTxString(value_string);
+	UARTTxString(SettleSamplesPrompt);
+	NumToString(end->num_samples - start->num_samples, value_string);
+	UARTTxString(value_string);
+	UARTTxString(SettleTimeoutsPrompt);
+	NumToString(end->num_timeouts - start->num_timeouts, value_string);
+	UARTTxString(value_string);
+	UARTTxString(SettleMaxPrompt);
+	NumToString(end->max_samples, value_string);
+	UARTTxString(value_string);
+	UARTTxString(SettleEndPrompt);
+}
+
+/********************************************************************
+* DisplayGrade - Function for showing an IC's speed grade
+*
+* Description:  The shortest settle delay from CheckerStepShmoo is
+* 				graded A up to GRADE_A_CYCLES, B up to GRADE_B_CYCLES,
+* 				C above, and F if the IC failed at every delay. The
+* 				grade letter is shown at the end of the first LCD line,
+* 				after the pass prompt. One line is sent over the UART
+* 				debug link with the delay and grade (e.g. "74HC00
+* 				settle min:1 grade:A").
+*
+* Return value:	none
+*
+* Arguments:    uint8_t ic_index - Library index of swept IC
+*
+* 				uint8_t min_cycles - Shortest passing settle delay
+* 				left by CheckerStepShmoo
+********************************************************************/
+void DisplayGrade(uint8_t ic_index, uint8_t min_cycles)
+{
+	uint8_t value_string[6];
+	uint8_t grade = 3U;
+
+	if(min_cycles <= GRADE_A_CYCLES)
+	{
+		grade = 0;
+	} else if(min_cycles <= GRADE_B_CYCLES)
+	{
+		grade = 1U;
+	} else if(min_cycles != CHECKER_SHMOO_NONE)
+	{
+		grade = 2U;
+	}
+
+	LCDMoveCursor(LCD_GRADE_COLUMN,1U);
+	LCDDisplayString(GradePrompts[grade]);
+
+	UARTTxString(ICNamePrompts[ic_index]);
+	UARTTxString(GradeUartPrompt);
+	if(min_cycles == CHECKER_SHMOO_NONE)
+	{
+		UARTTxString(TpdNonePrompt);
+	} else
+	{
+		NumToString(min_cycles, value_string);
+		UARTTxString(value_string);
+	}
+	UARTTxString(GradeSeparatorPrompt);
+	UARTTxString(GradePrompts[grade]);
+	UARTTxString(DiagEndPrompt);
+}
+
+/********************************************************************
+* DisplaySoak - Function for showing soak test results
+*
+* Description:  Shows SoakPassPrompt if no vector read failed,
+* 				otherwise SoakFailPrompt, with the IC's name after it.
+* 				The second LCD line holds the fail rate in parts per
+* 				million of vector reads, followed by the number of reads
+* 				when it fits (e.g. "12 ppm n=409600"). One line is sent
+* 				over the UART debug link with the passes run, failed
+* 				passes, and fail rate, then every vector that failed
+* 				with its failed reads, numbered from V0 in the order
+* 				vectors are applied (e.g. "74HC00 soak passes:102400
+* 				failed:3 ppm:7 V2:3").
+*
+* Return value:	none
+*
+* Arguments:    uint8_t ic_index - Library index of soaked IC
+*
+* 				const CHECKER_SOAK_T *soak - Soak statistics from
+* 				CheckerRunSoak
+********************************************************************/
+void DisplaySoak(uint8_t ic_index, const CHECKER_SOAK_T *soak)
+{
+	uint8_t lcd_line[LCD_COLUMNS + 1] = {'\0'};
+	uint8_t lcd_length = 0;
+	uint8_t value_string[11];
+	uint32_t fail_ppm = 0;
+
+	if(soak->num_reads != 0)
+	{
+		fail_ppm = (uint32_t)((soak->num_fails*PPM_SCALE)/soak->num_reads);
+	}
+
+	LCDClearDisplay();
+	LCDMoveCursor(1U,1U);
+	LCDDisplayString((soak->num_fails == 0) ? SoakPassPrompt : SoakFailPrompt);
+	LCDMoveCursor(LCD_NAME_COLUMN,1U);
+	LCDDisplayString(ICNamePrompts[ic_index]);
+
+	NumToString(fail_ppm, value_string);
+	lcd_length = AppendString(lcd_line, lcd_length, value_string);
+	lcd_length = AppendString(lcd_line, lcd_length, SoakPpmPrompt);
+	if((lcd_length + 3U + NumToString(soak->num_reads, value_string)) <= LCD_COLUMNS)
+	{
+		lcd_length = AppendString(lcd_line, lcd_length, SoakReadsPrompt);
+		lcd_length = AppendString(lcd_line, lcd_length, value_string);
+	}
+	LCDMoveCursor(1U,2U);
+	LCDDisplayString(lcd_line);
+
+	UARTTxString(ICNamePrompts[ic_index]);
+	UARTTxString(SoakUartPrompt);
+	NumToString(soak->num_passes, value_string);
+	UARTTxString(value_string);
+	UARTTxString(SoakFailedPrompt);
+	NumToString(soak->num_failed_passes, value_string);
+	UARTTxString(value_string);
+	UARTTxString(SoakRatePrompt);
+	NumToString(fail_ppm, value_string);
+	UARTTxString(value_string);
+
+	for(uint8_t vector_num = 0; vector_num < soak->num_vectors; vector_num++)
+	{
+		if(soak->vector_fails[vector_num] == 0) continue;
+
+		NumToString(vector_num, value_string);
+		UARTTxString(SoakVectorPrompt);
+		UARTTxString(value_string);
+		NumToString(soak->vector_fails[vector_num], value_string);
+		UARTTxString(DiagSeparatorPrompt);
+		UARTTxString(value_string);
+	}
+
+	UARTTxString(DiagEndPrompt);
+}
+
+/********************************************************************
+* NumToString - Converts a number to decimal ASCII
+*
+* Description:  Digits are found least significant first into a
+* 				temporary buffer, then copied out in reading order
+* 				with a null terminator.
+*
+* Return value:	Number of digits written
+*
+* Arguments:    uint32_t value - Number to convert
+*
+* 				uint8_t *string - Array to hold the digits and
+* 				terminator, of at least 6 characters for values
+* 				below 65536 and 11 otherwise
+********************************************************************/
+uint8_t NumToString(uint32_t value, uint8_t *string)
+{
+	uint8_t digits[10];
+	uint8_t num_digits = 0;
+
+	do
+	{
+		digits[num_digits++] = '0' + (value % 10U);
+		value /= 10U;
+	} while(value > 0);
+
+	for(uint8_t digit_num = 0; digit_num < num_digits; digit_num++)
+	{
+		string[digit_num] = digits[num_digits - 1U - digit_num];
+	}
+	string[num_digits] = '\0';
+	return num_digits;
+}
+
+/********************************************************************
+* HexToString - Converts a number to four hex ASCII digits
+*
+* Description:  Digits are written most significant first, with
+* 				leading zeros and a null terminator.
+*
+* Return value:	None
+*
+* Arguments:    uint16_t value - Number to convert
+*
+* 				uint8_t *string - Array of at least 5 characters to
+* 				hold the digits and terminator
+********************************************************************/
+void HexToString(uint16_t value, uint8_t *string)
+{
+	uint8_t nibble;
+
+	for(uint8_t digit_num = 0; digit_num < 4U; digit_num++)
+	{
+		nibble = (value >> (12U - (4U * digit_num))) & 0x0F;
+		string[digit_num] = (nibble < 10U) ? ('0' + nibble) : ('A' - 10 + nibble);
+	}
+	string[4] = '\0';
+}
+
+/********************************************************************
+* AppendString - Appends a string to an LCD line if it fits
+*
+* Description:  The whole string is copied to the end of the line,
+* 				with a null terminator, only if the line then still
+* 				fits within LCD_COLUMNS. Otherwise the line is left
+* 				unchanged.
+*
+* Return value:	New length of line
+*
+* Arguments:    uint8_t *line - Array of LCD_COLUMNS + 1 characters
+*
+* 				uint8_t length - Current length of line
+*
+* 				const uint8_t *string - String to append, with null
+* 				('\0') termination
+********************************************************************/
+uint8_t AppendString(uint8_t *line, uint8_t length, const uint8_t *string)
+{
+	uint8_t string_length = 0;
+
+	while(string[string_length] != '\0') string_length++;
+
+	if((length + string_length) > LCD_COLUMNS) return length;
+
+	for(uint8_t char_num = 0; char_num <= string_length; char_num++)
+	{
+		line[length + char_num] = string[char_num];
 	}
+	return (length + string_length);
 }
@@ -0,0 +1,1058 @@
+/******************************************************************************
+* 	ICLibGen.c
+*
+* 	Host side generator for the IC library tables. Built and run on the
+* 	development machine (not the MCU) before the firmware is built. Reads the
+* 	IC description file (Src/ICLibrary.icd), where each gate IC is given by
+* 	its package, output stage, pinout, and the boolean function of its gates,
+* 	and each sequential IC by name. Gate truth tables, the input and output
+* 	pin fields, and the expected output words of every IC are worked out
+* 	here, so the firmware does no setup work per IC. Result is written as
+* 	flash tables to Src/ICTables.c and Src/ICTables.h, along with the IC
+* 	designators and the name and pass prompts shown for each IC.
+*
+* 	Usage: ICLibGen <description path> <output .c path> <output .h path>
+*
+* 	10/16/2026:
+* 	Created and completed description parsing, gate function evaluation and
+* 	table output.
+*
+* 	10/16/2026:
+* 	Output lines end in CRLF, as in the rest of the tree, so regenerating
+* 	on any host gives the same files.
+*
+* 	10/16/2026:
+* 	Package pins taken from CHECKER_PACKAGE_PINS in Checker.h rather than a
+* 	copy of the firmware's table.
+*
+* 	10/16/2026:
+* 	MAX_NAME_LENGTH comment corrected, as names are also shown after the
+* 	fault and soak prompts.
+*
+* 	10/16/2026:
+* 	Added genGroupVectors and genBuildExpect, which build each gate IC's
+* 	group vectors as the firmware does and write the expected output words
+* 	of every block of CHECKER_STEP_VECTORS vectors, so CheckerStepGroup
+* 	checks a block with one XOR per gate. Pin fields worked out in
+* 	genParseGate.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "Checker.h"
+
+/******************************************************************************
+* Private Definitions
+******************************************************************************/
+#define MAX_ICS 32
+// Most ICs of both kinds, one result bit each in main.c
+
+#define MAX_NAME_LENGTH 7
+// Longest IC name, so the pass prompt and speed grade fit an LCD line, and
+// a name shown after the fault or soak prompts (LCD_NAME_COLUMN in main.c)
+// fits the rest of it
+
+#define MAX_GATE_INPUTS 4
+// Most inputs per gate, so the truth table fits 16 bits
+
+#define MAX_LINE_LENGTH 256
+#define MAX_FIELDS 9
+// Description file line and field limits
+
+#define MAX_EXPECT_WORDS (((CHECKER_MAX_VECTORS + CHECKER_STEP_VECTORS - 1)/CHECKER_STEP_VECTORS)*(CHECKER_MAX_GATES + 1))
+// Most expected words of an IC, a care word and one word per gate for each
+// block of CHECKER_STEP_VECTORS vectors
+
+#define PASS_SUFFIX " Passed"
+// Appended to an IC name to form its pass prompt
+
+#define PIN_LEVEL(field, ic_pin) (((field) >> (ic_pin)) & 0x01)
+
+typedef struct {
+	char name[MAX_NAME_LENGTH + 1];
+	uint8_t package;
+	uint8_t output_type;
+	char function[MAX_LINE_LENGTH];
+	uint16_t truth_table;
+	uint8_t num_inputs;
+	uint8_t num_outputs;
+	uint8_t input_pins[CHECKER_MAX_PINS];
+	uint8_t output_pins[CHECKER_MAX_GATES];
+	PIN_FIELD_T enable_field;
+	PIN_FIELD_T enable_levels;
+	PIN_FIELD_T input_field;
+	PIN_FIELD_T output_field;
+	uint8_t num_vectors;
+	uint32_t expect_words[MAX_EXPECT_WORDS];
+	uint8_t input_list;
+	uint8_t output_list;
+	uint8_t expect_list;} GEN_IC_T;
+// IC read from the description file. Pin lists and expected words are
+// written once and shared by every IC with the same list (input_list,
+// output_list, and expect_list give the IC that owns the list written).
+// num_vectors is the size of the IC's group vector list.
+
+/******************************************************************************
+* Private Function Prototypes
+******************************************************************************/
+static uint8_t genReadDescription(const char *);
+static uint8_t genParseGate(char **, uint8_t);
+static uint8_t genParseName(const char *, GEN_IC_T *);
+static uint8_t genParsePins(const char *, uint8_t *, uint8_t);
+static uint8_t genParseEnables(const char *, GEN_IC_T *);
+static uint8_t genCheckPins(const GEN_IC_T *);
+static uint8_t genTruthTable(GEN_IC_T *);
+static int8_t genEvalOr(uint8_t);
+static int8_t genEvalXor(uint8_t);
+static int8_t genEvalAnd(uint8_t);
+static int8_t genEvalNot(uint8_t);
+static uint8_t genGroupVectors(uint8_t, PIN_FIELD_T *);
+static uint8_t genBuildExpect(void);
+static void genShareLists(void);
+static void genWriteList(FILE *, const char *, const char *, const uint8_t *, uint8_t);
+static void genWriteExpect(FILE *, const GEN_IC_T *);
+static void genWriteDesignator(FILE *, const char *);
+static void genWriteListName(FILE *, const char *, const char *);
+static uint8_t genWriteSource(const char *);
+static uint8_t genWriteHeader(const char *);
+
+/******************************************************************************
+* Private Global Variables
+******************************************************************************/
+static const PACKAGE_PINS_T genPackages[CHECKER_NUM_PACKAGES] = CHECKER_PACKAGE_PINS;
+// Number of pins and supply pins of each package, as used by the firmware
+
+static const char *const genPackageNames[CHECKER_NUM_PACKAGES] = {
+	[PACKAGE_DIP14] = "DIP14",
+	[PACKAGE_DIP16] = "DIP16",
+	[PACKAGE_DIP20] = "DIP20",
+	[PACKAGE_DIP16_VCC5] = "DIP16_VCC5"};
+// Package names as written in the description file, written to the tables
+// with a PACKAGE_ prefix
+
+static const char *const genOutputNames[] = {
+	[OUTPUT_PUSH_PULL] = "PUSH_PULL",
+	[OUTPUT_TRI_STATE] = "TRI_STATE",
+	[OUTPUT_OPEN_DRAIN] = "OPEN_DRAIN"};
+// Output stage names as written in the description file, written to the
+// tables with an OUTPUT_ prefix
+
+static GEN_IC_T genICs[MAX_ICS];
+static uint8_t genNumICs;
+static uint8_t genNumGates;
+// ICs in description file order, gate ICs then sequential ICs
+
+static const char *genExprPos;
+static uint8_t genExprInputs;
+// Gate function parse position, and number of gate inputs it may use
+
+static const char *genPath;
+static uint16_t genLine;
+// Description file and line, for error messages
+
+int main(int argc, char *argv[])
+{
+	if(argc != 4)
+	{
+		fprintf(stderr, "Usage: ICLibGen <description path> <output .c path> <output .h path>\n");
+		return 1;
+	}
+
+	if(genReadDescription(argv[1]) != 0 || genBuildExpect() != 0) return 1;
+
+	genShareLists();
+
+	if(genWriteSource(argv[2]) != 0 || genWriteHeader(argv[3]) != 0)
+	{
+		fprintf(stderr, "ICLibGen: could not write output files\n");
+		return 1;
+	}
+
+	printf("ICLibGen: %u gate ICs, %u sequential ICs\n", genNumGates, genNumICs - genNumGates);
+	return 0;
+}
+
+/********************************************************************
+* genReadDescription - Reads every IC of the description file
+*
+* Description:  Text after '#' is a comment. Each remaining line is
+* 				split into fields at spaces and tabs. A "gate" line
+* 				adds a gate IC (see genParseGate), and a "sequence" line
+* 				adds a sequential IC by name. Gate ICs must all come
+* 				before sequential ICs, as the designator of an IC is its
+* 				result bit.
+*
+* Return value:	Zero on success
+*
+* Arguments:    const char *path - Description file path
+********************************************************************/
+static uint8_t genReadDescription(const char *path)
+{
+	FILE *in = fopen(path, "r");
+	char line[MAX_LINE_LENGTH];
+	char *fields[MAX_FIELDS + 1];
+	uint8_t num_fields;
+	char *comment;
+	uint8_t error = 0;
+
+	genPath = path;
+	if(in == NULL)
+	{
+		fprintf(stderr, "ICLibGen: could not open %s\n", path);
+		return 1;
+	}
+
+	while(error == 0 && fgets(line, sizeof(line), in) != NULL)
+	{
+		genLine++;
+
+		comment = strchr(line, '#');
+		if(comment != NULL) *comment = '\0';
+
+		num_fields = 0;
+		for(char *field = strtok(line, " \t\r\n"); field != NULL; field = strtok(NULL, " \t\r\n"))
+		{
+			if(num_fields > MAX_FIELDS) break;
+			fields[num_fields++] = field;
+		}
+		if(num_fields == 0) continue;
+
+		if(genNumICs >= MAX_ICS)
+		{
+			fprintf(stderr, "%s:%u: more than %u ICs\n", genPath, genLine, MAX_ICS);
+			error = 1;
+		} else if(strcmp(fields[0], "gate") == 0)
+		{
+			if(genNumGates != genNumICs)
+			{
+				fprintf(stderr, "%s:%u: gate ICs must come before sequential ICs\n", genPath, genLine);
+				error = 1;
+			} else
+			{
+				error = genParseGate(&fields[1], num_fields - 1);
+				if(error == 0) genNumGates++;
+			}
+		} else if(strcmp(fields[0], "sequence") == 0 && num_fields == 2)
+		{
+			error = genParseName(fields[1], &genICs[genNumICs]);
+		} else
+		{
+			fprintf(stderr, "%s:%u: expected gate or sequence line\n", genPath, genLine);
+			error = 1;
+		}
+
+		if(error == 0) genNumICs++;
+	}
+
+	fclose(in);
+	return error;
+}
+
+/********************************************************************
+* genParseGate - Reads a gate IC line
+*
+* Description:  Fields are name, package, output stage, gate
+* 				function, input pins, output pins, and optionally
+* 				enable pins with their levels. Inputs are split evenly
+* 				between the gates, and the pin fields and truth table
+* 				are worked out from the pins and function.
+*
+* Return value:	Zero on success
+*
+* Arguments:    char **fields - Fields after "gate"
+*
+* 				uint8_t num_fields - Number of fields
+********************************************************************/
+static uint8_t genParseGate(char **fields, uint8_t num_fields)
+{
+	GEN_IC_T *IC = &genICs[genNumICs];
+	uint8_t package;
+	uint8_t output_type;
+
+	if(num_fields != 6 && num_fields != 7)
+	{
+		fprintf(stderr, "%s:%u: gate line needs 6 or 7 fields\n", genPath, genLine);
+		return 1;
+	}
+
+	if(genParseName(fields[0], IC) != 0) return 1;
+
+	for(package = 0; package < CHECKER_NUM_PACKAGES; package++)
+	{
+		if(strcmp(fields[1], genPackageNames[package]) == 0) break;
+	}
+	if(package == CHECKER_NUM_PACKAGES)
+	{
+		fprintf(stderr, "%s:%u: unknown package %s\n", genPath, genLine, fields[1]);
+		return 1;
+	}
+	IC->package = package;
+
+	for(output_type = 0; output_type < sizeof(genOutputNames)/sizeof(genOutputNames[0]); output_type++)
+	{
+		if(strcmp(fields[2], genOutputNames[output_type]) == 0) break;
+	}
+	if(output_type == sizeof(genOutputNames)/sizeof(genOutputNames[0]))
+	{
+		fprintf(stderr, "%s:%u: unknown output stage %s\n", genPath, genLine, fields[2]);
+		return 1;
+	}
+	IC->output_type = output_type;
+
+	strcpy(IC->function, fields[3]);
+	IC->num_inputs = genParsePins(fields[4], IC->input_pins, CHECKER_MAX_PINS);
+	IC->num_outputs = genParsePins(fields[5], IC->output_pins, CHECKER_MAX_GATES);
+	if(IC->num_inputs == 0 || IC->num_outputs == 0) return 1;
+
+	if(num_fields == 7 && genParseEnables(fields[6], IC) != 0) return 1;
+
+	if((IC->num_inputs % IC->num_outputs) != 0 || (IC->num_inputs/IC->num_outputs) > MAX_GATE_INPUTS)
+	{
+		fprintf(stderr, "%s:%u: inputs must split evenly into gates of %u or less\n",
+				genPath, genLine, MAX_GATE_INPUTS);
+		return 1;
+	}
+
+	if(genCheckPins(IC) != 0) return 1;
+
+	IC->input_field = IC->enable_field;
+	for(uint8_t input_num = 0; input_num < IC->num_inputs; input_num++)
+	{
+		IC->input_field |= CHECKER_PIN(IC->input_pins[input_num]);
+	}
+	for(uint8_t output_num = 0; output_num < IC->num_outputs; output_num++)
+	{
+		IC->output_field |= CHECKER_PIN(IC->output_pins[output_num]);
+	}
+	return genTruthTable(IC);
+}
+
+/********************************************************************
+* genParseName - Reads and checks an IC name
+*
+* Description:  Name must be letters and digits only, as it forms
+* 				the IC designator, and must not already be used.
+*
+* Return value:	Zero on success
+*
+* Arguments:    const char *name - Name field
+*
+* 				GEN_IC_T *IC - IC to name
+********************************************************************/
+static uint8_t genParseName(const char *name, GEN_IC_T *IC)
+{
+	if(strlen(name) == 0 || strlen(name) > MAX_NAME_LENGTH)
+	{
+		fprintf(stderr, "%s:%u: name must be 1 to %u characters\n", genPath, genLine, MAX_NAME_LENGTH);
+		return 1;
+	}
+
+	for(const char *character = name; *character != '\0'; character++)
+	{
+		if(isalnum((unsigned char)*character) == 0)
+		{
+			fprintf(stderr, "%s:%u: name %s must be letters and digits only\n", genPath, genLine, name);
+			return 1;
+		}
+	}
+
+	for(uint8_t ic_num = 0; ic_num < genNumICs; ic_num++)
+	{
+		if(strcmp(genICs[ic_num].name, name) == 0)
+		{
+			fprintf(stderr, "%s:%u: %s already given\n", genPath, genLine, name);
+			return 1;
+		}
+	}
+
+	strcpy(IC->name, name);
+	return 0;
+}
+
+/********************************************************************
+* genParsePins - Reads a comma separated list of package pins
+*
+* Return value:	Number of pins read, zero on error
+*
+* Arguments:    const char *list - Pin list field
+*
+* 				uint8_t *pins - Array to fill
+*
+* 				uint8_t max_pins - Size of pins
+********************************************************************/
+static uint8_t genParsePins(const char *list, uint8_t *pins, uint8_t max_pins)
+{
+	uint8_t num_pins = 0;
+	unsigned long ic_pin;
+	char *end;
+
+	while(1)
+	{
+		ic_pin = strtoul(list, &end, 10);
+		if(end == list || ic_pin < 1 || ic_pin > CHECKER_MAX_PINS || num_pins >= max_pins)
+		{
+			fprintf(stderr, "%s:%u: bad pin list (1 to %u pins of 1 to %u)\n",
+					genPath, genLine, max_pins, CHECKER_MAX_PINS);
+			return 0;
+		}
+		pins[num_pins++] = (uint8_t)ic_pin;
+
+		if(*end == '\0') return num_pins;
+		if(*end != ',')
+		{
+			fprintf(stderr, "%s:%u: bad pin list\n", genPath, genLine);
+			return 0;
+		}
+		list = end + 1;
+	}
+}
+
+/********************************************************************
+* genParseEnables - Reads a comma separated list of enable pins
+*
+* Description:  Each enable pin is given as pin=level, with a level
+* 				of 0 or 1.
+*
+* Return value:	Zero on success
+*
+* Arguments:    const char *list - Enable list field
+*
+* 				GEN_IC_T *IC - IC to fill enable fields of
+********************************************************************/
+static uint8_t genParseEnables(const char *list, GEN_IC_T *IC)
+{
+	unsigned long ic_pin;
+	char *end;
+
+	while(1)
+	{
+		ic_pin = strtoul(list, &end, 10);
+		if(end == list || ic_pin < 1 || ic_pin > CHECKER_MAX_PINS || end[0] != '=' ||
+		   (end[1] != '0' && end[1] != '1'))
+		{
+			fprintf(stderr, "%s:%u: bad enable list (pin=level, level 0 or 1)\n", genPath, genLine);
+			return 1;
+		}
+
+		IC->enable_field |= CHECKER_PIN(ic_pin);
+		if(end[1] == '1') IC->enable_levels |= CHECKER_PIN(ic_pin);
+
+		end += 2;
+		if(*end == '\0') return 0;
+		if(*end != ',')
+		{
+			fprintf(stderr, "%s:%u: bad enable list\n", genPath, genLine);
+			return 1;
+		}
+		list = end + 1;
+	}
+}
+
+/********************************************************************
+* genCheckPins - Checks an IC's pins fit its package
+*
+* Description:  Every input, output, and enable pin must be a package
+* 				pin other than VCC and GND, and used only once.
+*
+* Return value:	Zero on success
+*
+* Arguments:    const GEN_IC_T *IC - IC to check
+********************************************************************/
+static uint8_t genCheckPins(const GEN_IC_T *IC)
+{
+	const PACKAGE_PINS_T *package = &genPackages[IC->package];
+	PIN_FIELD_T used_field = CHECKER_PIN(package->vcc_pin) | CHECKER_PIN(package->gnd_pin);
+	PIN_FIELD_T enable_field = IC->enable_field;
+	uint8_t pins[CHECKER_MAX_PINS + CHECKER_MAX_GATES];
+	uint8_t num_pins = 0;
+
+	for(uint8_t input_num = 0; input_num < IC->num_inputs; input_num++)
+	{
+		pins[num_pins++] = IC->input_pins[input_num];
+	}
+	for(uint8_t output_num = 0; output_num < IC->num_outputs; output_num++)
+	{
+		pins[num_pins++] = IC->output_pins[output_num];
+	}
+
+	for(uint8_t pin_num = 0; pin_num < num_pins; pin_num++)
+	{
+		if(pins[pin_num] > package->num_pins || PIN_LEVEL(used_field | enable_field, pins[pin_num]))
+		{
+			fprintf(stderr, "%s:%u: pin %u is used twice, a supply pin, or not a %s pin\n",
+					genPath, genLine, pins[pin_num], genPackageNames[IC->package]);
+			return 1;
+		}
+		used_field |= CHECKER_PIN(pins[pin_num]);
+	}
+
+	if((enable_field & (used_field | ~(((PIN_FIELD_T)CHECKER_PIN(package->num_pins) << 1) - 2UL))) != 0)
+	{
+		fprintf(stderr, "%s:%u: enable pin is used twice, a supply pin, or not a %s pin\n",
+				genPath, genLine, genPackageNames[IC->package]);
+		return 1;
+	}
+	return 0;
+}
+
+/********************************************************************
+* genTruthTable - Works out the packed truth table of a gate function
+*
+* Description:  The function is evaluated for every value n of the
+* 				gate inputs, with input A as bit 0 and input D as bit
+* 				3, and the result placed in truth table bit n (see
+* 				IC_PARAMETERS_T). Functions may only use the inputs a
+* 				gate has.
+*
+* Return value:	Zero on success
+*
+* Arguments:    GEN_IC_T *IC - IC with function to evaluate
+********************************************************************/
+static uint8_t genTruthTable(GEN_IC_T *IC)
+{
+	int8_t output;
+
+	genExprInputs = IC->num_inputs/IC->num_outputs;
+	IC->truth_table = 0;
+
+	for(uint8_t tt_index = 0; tt_index < (1U << genExprInputs); tt_index++)
+	{
+		genExprPos = IC->function;
+		output = genEvalOr(tt_index);
+
+		if(output >= 0 && *genExprPos != '\0') output = -1;
+		if(output < 0)
+		{
+			fprintf(stderr, "%s:%u: bad function %s near \"%s\" (inputs A to %c, ~ & ^ | and parentheses)\n",
+					genPath, genLine, IC->function, genExprPos, 'A' + genExprInputs - 1);
+			return 1;
+		}
+		IC->truth_table |= ((uint16_t)output << tt_index);
+	}
+	return 0;
+}
+
+/********************************************************************
+* genEvalOr - Evaluates OR terms of a gate function
+*
+* Description:  Recursive descent evaluation, from lowest to highest
+* 				precedence: | (genEvalOr), ^ (genEvalXor), &
+* 				(genEvalAnd), then ~, inputs, and parentheses
+* 				(genEvalNot). Each reads from genExprPos and leaves it
+* 				after the part it evaluated.
+*
+* Return value:	Value of 0 or 1, or -1 on error
+*
+* Arguments:    uint8_t tt_index - Gate input values
+********************************************************************/
+static int8_t genEvalOr(uint8_t tt_index)
+{
+	int8_t value = genEvalXor(tt_index);
+	int8_t term;
+
+	while(value >= 0 && *genExprPos == '|')
+	{
+		genExprPos++;
+		term = genEvalXor(tt_index);
+		value = (term < 0) ? term : (value | term);
+	}
+	return value;
+}
+
+/********************************************************************
+* genEvalXor - Evaluates XOR terms of a gate function
+*
+* Return value:	Value of 0 or 1, or -1 on error
+*
+* Arguments:    uint8_t tt_index - Gate input values
+********************************************************************/
+static int8_t genEvalXor(uint8_t tt_index)
+{
+	int8_t value = genEvalAnd(tt_index);
+	int8_t term;
+
+	while(value >= 0 && *genExprPos == '^')
+	{
+		genExprPos++;
+		term = genEvalAnd(tt_index);
+		value = (term < 0) ? term : (value ^ term);
+	}
+	return value;
+}
+
+/********************************************************************
+* genEvalAnd - Evaluates AND terms of a gate function
+*
+* Return value:	Value of 0 or 1, or -1 on error
+*
+* Arguments:    uint8_t tt_index - Gate input values
+********************************************************************/
+static int8_t genEvalAnd(uint8_t tt_index)
+{
+	int8_t value = genEvalNot(tt_index);
+	int8_t term;
+
+	while(value >= 0 && *genExprPos == '&')
+	{
+		genExprPos++;
+		term = genEvalNot(tt_index);
+		value = (term < 0) ? term : (value & term);
+	}
+	return value;
+}
+
+/********************************************************************
+* genEvalNot - Evaluates an inverted term, input, or parentheses
+*
+* Return value:	Value of 0 or 1, or -1 on error
+*
+* Arguments:    uint8_t tt_index - Gate input values
+********************************************************************/
+static int8_t genEvalNot(uint8_t tt_index)
+{
+	int8_t value;
+	uint8_t input_offset;
+
+	if(*genExprPos == '~')
+	{
+		genExprPos++;
+		value = genEvalNot(tt_index);
+		return (value < 0) ? value : (value ^ 0x01);
+	}
+
+	if(*genExprPos == '(')
+	{
+		genExprPos++;
+		value = genEvalOr(tt_index);
+		if(value < 0 || *genExprPos != ')') return -1;
+		genExprPos++;
+		return value;
+	}
+
+	input_offset = (uint8_t)(*genExprPos - 'A');
+	if(input_offset >= genExprInputs) return -1;
+	genExprPos++;
+	return ((tt_index >> input_offset) & 0x01);
+}
+
+/********************************************************************
+* genGroupVectors - Builds the vector list of a gate IC's group
+*
+* Description:  Mirrors checkerBuildVectors for the group the IC is
+* 				tested in (see CheckerGroupField): every gate IC of the
+* 				same package and input pins, in library order. Each
+* 				gives every input combination of a gate in Gray code
+* 				order, to all gates at once when CHECKER_PARALLEL_GATES
+* 				is set, otherwise to one gate at a time, with enable
+* 				pins at its enable levels. Vectors already in the list
+* 				are not repeated, so the list matches the firmware's
+* 				vector for vector.
+*
+* Return value:	Number of vectors, zero if the group needs more than
+* 				CHECKER_MAX_VECTORS
+*
+* Arguments:    uint8_t ic_num - Gate IC to build the group of
+*
+* 				PIN_FIELD_T *vectors - Array of CHECKER_MAX_VECTORS
+* 				input levels to fill
+********************************************************************/
+static uint8_t genGroupVectors(uint8_t ic_num, PIN_FIELD_T *vectors)
+{
+	const GEN_IC_T *IC;
+	PIN_FIELD_T pin_levels;
+	uint8_t num_vectors = 0;
+	uint8_t num_inputs_gate;
+	uint8_t num_groups;
+	uint8_t gray_code;
+	uint8_t vector_num;
+	uint16_t gate_mask;
+
+	for(uint8_t lib_index = 0; lib_index < genNumGates; lib_index++)
+	{
+		IC = &genICs[lib_index];
+		if(IC->package != genICs[ic_num].package || IC->input_field != genICs[ic_num].input_field) continue;
+
+		num_inputs_gate = IC->num_inputs/IC->num_outputs;
+		num_groups = (CHECKER_PARALLEL_GATES == TRUE) ? 1U : IC->num_outputs;
+
+		for(uint8_t group_num = 0; group_num < num_groups; group_num++)
+		{
+			gate_mask = (CHECKER_PARALLEL_GATES == TRUE) ? ((1U << IC->num_outputs) - 1U) : (1U << group_num);
+
+			for(uint8_t combo = 0; combo < (1U << num_inputs_gate); combo++)
+			{
+				gray_code = combo ^ (combo >> 1);
+				pin_levels = IC->enable_levels;
+				for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+				{
+					if(((gate_mask >> gate_num) & 0x01) == 0) continue;
+
+					for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+					{
+						if((gray_code >> input_offset) & 0x01)
+						{
+							pin_levels |= CHECKER_PIN(IC->input_pins[(gate_num*num_inputs_gate) + input_offset]);
+						}
+					}
+				}
+
+				for(vector_num = 0; vector_num < num_vectors; vector_num++)
+				{
+					if(vectors[vector_num] == pin_levels) break;
+				}
+				if(vector_num < num_vectors) continue;
+
+				if(num_vectors >= CHECKER_MAX_VECTORS) return 0;
+				vectors[num_vectors++] = pin_levels;
+			}
+		}
+	}
+	return num_vectors;
+}
+
+/********************************************************************
+* genBuildExpect - Works out the expected words of every gate IC
+*
+* Description:  Each IC's group vectors (see genGroupVectors) are
+* 				split into blocks of CHECKER_STEP_VECTORS, as
+* 				CheckerStepGroup checks them. Each block is given a care
+* 				word, bit n set if vector n of the block holds every
+* 				enable pin at the IC's enable level (vectors built for
+* 				other candidates may not), then one word per gate in
+* 				output list order, bit n holding the gate's truth table
+* 				output for the inputs of vector n.
+*
+* Return value:	Zero on success
+*
+* Arguments:    None
+********************************************************************/
+static uint8_t genBuildExpect(void)
+{
+	PIN_FIELD_T vectors[CHECKER_MAX_VECTORS];
+	GEN_IC_T *IC;
+	uint32_t *block_words;
+	uint8_t num_inputs_gate;
+	uint8_t vector_bit;
+	uint8_t tt_index;
+
+	for(uint8_t ic_num = 0; ic_num < genNumGates; ic_num++)
+	{
+		IC = &genICs[ic_num];
+		IC->num_vectors = genGroupVectors(ic_num, vectors);
+		if(IC->num_vectors == 0)
+		{
+			fprintf(stderr, "ICLibGen: group of %s needs more than %u vectors\n", IC->name, CHECKER_MAX_VECTORS);
+			return 1;
+		}
+
+		num_inputs_gate = IC->num_inputs/IC->num_outputs;
+		for(uint8_t vector_num = 0; vector_num < IC->num_vectors; vector_num++)
+		{
+			block_words = &IC->expect_words[(vector_num/CHECKER_STEP_VECTORS)*(IC->num_outputs + 1U)];
+			vector_bit = vector_num % CHECKER_STEP_VECTORS;
+
+			if(((vectors[vector_num] ^ IC->enable_levels) & IC->enable_field) == 0)
+			{
+				block_words[0] |= (1UL << vector_bit);
+			}
+
+			for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+			{
+				tt_index = 0;
+				for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+				{
+					tt_index |= PIN_LEVEL(vectors[vector_num], IC->input_pins[(gate_num*num_inputs_gate) + input_offset]) << input_offset;
+				}
+				block_words[gate_num + 1U] |= ((uint32_t)((IC->truth_table >> tt_index) & 0x01) << vector_bit);
+			}
+		}
+	}
+	return 0;
+}
+
+/********************************************************************
+* genShareLists - Finds gate ICs sharing pin lists and expected words
+*
+* Description:  Each input list, output list, and expected word list
+* 				is matched against the lists of earlier gate ICs, and
+* 				refers to the first IC with the same list, so identical
+* 				lists are only written once.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+static void genShareLists(void)
+{
+	for(uint8_t ic_num = 0; ic_num < genNumGates; ic_num++)
+	{
+		GEN_IC_T *IC = &genICs[ic_num];
+
+		IC->input_list = ic_num;
+		IC->output_list = ic_num;
+		IC->expect_list = ic_num;
+		for(uint8_t list_num = 0; list_num < ic_num; list_num++)
+		{
+			const GEN_IC_T *other = &genICs[list_num];
+
+			if(IC->input_list == ic_num && other->input_list == list_num && other->num_inputs == IC->num_inputs &&
+			   memcmp(other->input_pins, IC->input_pins, IC->num_inputs) == 0) IC->input_list = list_num;
+
+			if(IC->output_list == ic_num && other->output_list == list_num && other->num_outputs == IC->num_outputs &&
+			   memcmp(other->output_pins, IC->output_pins, IC->num_outputs) == 0) IC->output_list = list_num;
+
+			if(IC->expect_list == ic_num && other->expect_list == list_num && other->num_vectors == IC->num_vectors &&
+			   other->num_outputs == IC->num_outputs &&
+			   memcmp(other->expect_words, IC->expect_words, sizeof(IC->expect_words)) == 0) IC->expect_list = list_num;
+		}
+	}
+}
+
+/********************************************************************
+* genWriteList - Writes a pin list array
+*
+* Return value:	None
+*
+* Arguments:    FILE *out - Output file
+*
+* 				const char *name - Name of IC owning the list
+*
+* 				const char *suffix - "Inputs" or "Outputs"
+*
+* 				const uint8_t *pins - Pin list
+*
+* 				uint8_t num_pins - Number of pins in list
+********************************************************************/
+static void genWriteList(FILE *out, const char *name, const char *suffix, const uint8_t *pins, uint8_t num_pins)
+{
+	fprintf(out, "static const uint8_t ");
+	genWriteListName(out, name, suffix);
+	fprintf(out, "[] = {");
+	for(uint8_t pin_num = 0; pin_num < num_pins; pin_num++)
+	{
+		fprintf(out, "%u%s", pins[pin_num], (pin_num + 1 < num_pins) ? ", " : "};\r\n");
+	}
+}
+
+/********************************************************************
+* genWriteExpect - Writes an expected word array
+*
+* Description:  One line is written per block of vectors, with the
+* 				care word first.
+*
+* Return value:	None
+*
+* Arguments:    FILE *out - Output file
+*
+* 				const GEN_IC_T *IC - IC owning the list
+********************************************************************/
+static void genWriteExpect(FILE *out, const GEN_IC_T *IC)
+{
+	uint8_t block_words = IC->num_outputs + 1U;
+	uint8_t num_words = ((IC->num_vectors + CHECKER_STEP_VECTORS - 1U)/CHECKER_STEP_VECTORS)*block_words;
+
+	fprintf(out, "static const uint32_t ");
+	genWriteListName(out, IC->name, "Expect");
+	fprintf(out, "[] = {\r\n");
+	for(uint8_t word_num = 0; word_num < num_words; word_num++)
+	{
+		fprintf(out, "%s0x%08lX", ((word_num % block_words) == 0) ? "\t" : " ", (unsigned long)IC->expect_words[word_num]);
+		if(word_num + 1 == num_words) fprintf(out, "};\r\n");
+		else fprintf(out, ((word_num + 1) % block_words == 0) ? ",\r\n" : ",");
+	}
+}
+
+/********************************************************************
+* genWriteDesignator - Writes the designator of an IC
+*
+* Return value:	None
+*
+* Arguments:    FILE *out - Output file
+*
+* 				const char *name - IC name
+********************************************************************/
+static void genWriteDesignator(FILE *out, const char *name)
+{
+	fprintf(out, "IC_");
+	for(const char *character = name; *character != '\0'; character++)
+	{
+		fputc(toupper((unsigned char)*character), out);
+	}
+}
+
+/********************************************************************
+* genWriteListName - Writes the name of a pin list array
+*
+* Return value:	None
+*
+* Arguments:    FILE *out - Output file
+*
+* 				const char *name - Name of IC owning the list
+*
+* 				const char *suffix - "Inputs", "Outputs", or "Expect"
+********************************************************************/
+static void genWriteListName(FILE *out, const char *name, const char *suffix)
+{
+	fprintf(out, "ic");
+	for(const char *character = name; *character != '\0'; character++)
+	{
+		fputc(tolower((unsigned char)*character), out);
+	}
+	fprintf(out, "%s", suffix);
+}
+
+/********************************************************************
+* genWriteSource - Writes pin and word lists, library, and prompts
+*
+* Return value:	Zero on success
+*
+* Arguments:    const char *path - Output file path
+********************************************************************/
+static uint8_t genWriteSource(const char *path)
+{
+	FILE *out = fopen(path, "wb");
+	const GEN_IC_T *IC;
+
+	if(out == NULL) return 1;
+
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* \tICTables.c\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tGenerated by Tools/ICLibGen from ICLibrary.icd. Do not edit.\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tMCU: STM32L053R8\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "#include <stdint.h>\r\n");
+	fprintf(out, "#include \"Checker.h\"\r\n");
+	fprintf(out, "#include \"ICTables.h\"\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* Private Constants\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	for(uint8_t ic_num = 0; ic_num < genNumGates; ic_num++)
+	{
+		IC = &genICs[ic_num];
+		if(IC->input_list == ic_num) genWriteList(out, IC->name, "Inputs", IC->input_pins, IC->num_inputs);
+		if(IC->output_list == ic_num) genWriteList(out, IC->name, "Outputs", IC->output_pins, IC->num_outputs);
+	}
+	fprintf(out, "// Gate pin lists, shared by every IC with the same list\r\n");
+	fprintf(out, "\r\n");
+	for(uint8_t ic_num = 0; ic_num < genNumGates; ic_num++)
+	{
+		if(genICs[ic_num].expect_list == ic_num) genWriteExpect(out, &genICs[ic_num]);
+	}
+	fprintf(out, "// Expected words of each block of CHECKER_STEP_VECTORS group vectors: care word,\r\n");
+	fprintf(out, "// then one output word per gate. Shared by every IC with the same words.\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* Public Constants\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "const IC_PARAMETERS_T ICLibrary[NUM_LIBRARY_ICS] = {\r\n");
+	for(uint8_t ic_num = 0; ic_num < genNumGates; ic_num++)
+	{
+		IC = &genICs[ic_num];
+
+		fprintf(out, "\t[");
+		genWriteDesignator(out, IC->name);
+		fprintf(out, "] = {");
+		genWriteDesignator(out, IC->name);
+		fprintf(out, ", PACKAGE_%s, %u, %u, 0x%04X, OUTPUT_%s, %u, ", genPackageNames[IC->package], IC->num_inputs,
+				IC->num_outputs, IC->truth_table, genOutputNames[IC->output_type], IC->num_vectors);
+		genWriteListName(out, genICs[IC->input_list].name, "Inputs");
+		fprintf(out, ", ");
+		genWriteListName(out, genICs[IC->output_list].name, "Outputs");
+		fprintf(out, ",\r\n\t\t");
+		genWriteListName(out, genICs[IC->expect_list].name, "Expect");
+		fprintf(out, ", 0x%06lX, 0x%06lX, 0x%06lX, 0x%06lX}%s\t// %s\r\n",
+				(unsigned long)IC->enable_field, (unsigned long)IC->enable_levels, (unsigned long)IC->input_field,
+				(unsigned long)IC->output_field, (ic_num + 1 < genNumGates) ? "," : " };", IC->function);
+	}
+	fprintf(out, "// Gate IC Parameters: IC Designator, package, # of inputs, # of outputs, gate truth\r\n");
+	fprintf(out, "// table, output stage, # of group vectors, list of input pins, list of output pins,\r\n");
+	fprintf(out, "// list of expected words, pin field of enable pins, pin field of enable levels, pin\r\n");
+	fprintf(out, "// field of input pins, and pin field of output pins. Gate function from the\r\n");
+	fprintf(out, "// description file follows each entry.\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "const uint8_t ICNamePrompts[NUM_IC_DESIGNATORS][IC_NAME_SIZE] = {\r\n");
+	for(uint8_t ic_num = 0; ic_num < genNumICs; ic_num++)
+	{
+		fprintf(out, "\t\"%s\"%s\r\n", genICs[ic_num].name, (ic_num + 1 < genNumICs) ? "," : "};");
+	}
+	fprintf(out, "// Name of each IC, indexed by IC designator\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "const uint8_t ICPassPrompts[NUM_IC_DESIGNATORS][IC_PASS_SIZE] = {\r\n");
+	for(uint8_t ic_num = 0; ic_num < genNumICs; ic_num++)
+	{
+		fprintf(out, "\t\"%s%s\"%s\r\n", genICs[ic_num].name, PASS_SUFFIX, (ic_num + 1 < genNumICs) ? "," : "};");
+	}
+	fprintf(out, "// Shown when a single IC passes, indexed by IC designator\r\n");
+
+	return (fclose(out) != 0);
+}
+
+/********************************************************************
+* genWriteHeader - Writes library sizes, designators, and declarations
+*
+* Return value:	Zero on success
+*
+* Arguments:    const char *path - Output file path
+********************************************************************/
+static uint8_t genWriteHeader(const char *path)
+{
+	FILE *out = fopen(path, "wb");
+
+	if(out == NULL) return 1;
+
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* \tICTables.h\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tGenerated by Tools/ICLibGen from ICLibrary.icd. Do not edit.\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tMCU: STM32L053R8\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "#ifndef ICTABLES_H_\r\n");
+	fprintf(out, "#define ICTABLES_H_\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* Public Definitions\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "#define NUM_LIBRARY_ICS %u\r\n", genNumGates);
+	fprintf(out, "#define NUM_SEQUENCE_ICS %u\r\n", genNumICs - genNumGates);
+	fprintf(out, "#define NUM_IC_DESIGNATORS %u\r\n", genNumICs);
+	fprintf(out, "// Number of gate ICs in ICLibrary, of sequential ICs in ICSequenceLibrary\r\n");
+	fprintf(out, "// (ICLibrary.c), and of both\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "#define IC_NAME_SIZE %u\r\n", MAX_NAME_LENGTH + 1);
+	fprintf(out, "#define IC_PASS_SIZE %u\r\n", (unsigned)(MAX_NAME_LENGTH + sizeof(PASS_SUFFIX)));
+	fprintf(out, "// Size of each name and pass prompt, with null termination\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "typedef enum {");
+	for(uint8_t ic_num = 0; ic_num < genNumICs; ic_num++)
+	{
+		if(ic_num != 0) fprintf(out, "\t\t\t  ");
+		genWriteDesignator(out, genICs[ic_num].name);
+		fprintf(out, "%s\r\n", (ic_num + 1 < genNumICs) ? "," : "} IC_DESIGNATOR_T;");
+	}
+	fprintf(out, "// IC designators, gate ICs then sequential ICs. Designator n is result\r\n");
+	fprintf(out, "// bit n in main.c.\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* Public Constants\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "extern const IC_PARAMETERS_T ICLibrary[NUM_LIBRARY_ICS];\r\n");
+	fprintf(out, "// Parameters of every gate IC the checker can identify, indexed by IC\r\n");
+	fprintf(out, "// designator\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "extern const uint8_t ICNamePrompts[NUM_IC_DESIGNATORS][IC_NAME_SIZE];\r\n");
+	fprintf(out, "extern const uint8_t ICPassPrompts[NUM_IC_DESIGNATORS][IC_PASS_SIZE];\r\n");
+	fprintf(out, "// Name and pass prompt of every IC, indexed by IC designator\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "#endif /* ICTABLES_H_ */\r\n");
+
+	return (fclose(out) != 0);
+}
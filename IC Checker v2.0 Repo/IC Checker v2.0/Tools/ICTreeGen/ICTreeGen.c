@@ -0,0 +1,538 @@
+/******************************************************************************
+* 	ICTreeGen.c
+*
+* 	Host side generator for the identification decision tree. Built and run
+* 	on the development machine (not the MCU) against the same ICLibrary used
+* 	by the firmware. Every candidate's response to every test vector of the
+* 	library is computed from its pinout and truth table, then a tree is built
+* 	where each node applies the vector and reads the pin that splits the
+* 	remaining candidates most evenly. Result is written as flash tables to
+* 	Src/ICTree.c and Src/ICTree.h.
+*
+* 	Usage: ICTreeGen <output .c path> <output .h path>
+*
+* 	10/16/2026:
+* 	Created and completed response calculation, greedy tree building and
+* 	table output.
+*
+* 	10/16/2026:
+* 	Tree is built for the ICs of one package (TREE_PACKAGE), given in the
+* 	output as IC_TREE_PACKAGE and IC_TREE_CANDIDATES. Pin fields widened to
+* 	PIN_FIELD_T, and enable pins held at their enable levels.
+*
+* 	10/16/2026:
+* 	High outputs of open-drain candidates are unknown, as the tree walk
+* 	reads them without a pull.
+*
+* 	10/16/2026:
+* 	Gate IC library read from the generated ICTables.
+*
+* 	10/16/2026:
+* 	Output lines end in CRLF, as in the rest of the tree, so regenerating
+* 	on any host gives the same files.
+*
+* 	10/16/2026:
+* 	Vectors driving an output pin of any candidate left are not chosen, so
+* 	the walk never drives against the inserted IC's outputs.
+*
+* 	10/16/2026:
+* 	Number of pins and IO pins of TREE_PACKAGE taken from
+* 	CHECKER_PACKAGE_PINS in Checker.h rather than hard-coded.
+*
+* 	Created on: 10/16/2026
+* 	Author: Anthony Needles
+******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include "Checker.h"
+#include "ICTables.h"
+
+/******************************************************************************
+* Private Definitions
+******************************************************************************/
+#define TREE_PACKAGE PACKAGE_DIP14
+// Package the tree is built for
+
+#define GEN_STRING(x) #x
+#define GEN_NAME(x) GEN_STRING(x)
+// Name of a definition's value, for writing TREE_PACKAGE to the output
+
+#define MAX_VECTORS 256
+#define MAX_NODES 127
+#define MAX_LEAVES 127
+// Table limits, node and leaf links must fit below CHECKER_TREE_LEAF
+
+#define RESP_LOW 0
+#define RESP_HIGH 1
+#define RESP_UNKNOWN 2
+// Response of a candidate on a read pin. Unknown when the pin is not
+// driven by the candidate for that vector (floating input, no connect, a
+// gate with undriven inputs, or a Hi-Z output).
+
+#define PIN_LEVEL(field, ic_pin) (((field) >> (ic_pin)) & 0x01)
+
+typedef struct {
+	PIN_FIELD_T drive_field;
+	PIN_FIELD_T level_field;} GEN_VECTOR_T;
+// Candidate vector: driven package pins and their levels
+
+/******************************************************************************
+* Private Function Prototypes
+******************************************************************************/
+static void genAddVector(PIN_FIELD_T, PIN_FIELD_T);
+static void genBuildVectors(void);
+static uint8_t genResponse(const IC_PARAMETERS_T *, const GEN_VECTOR_T *, uint8_t);
+static uint8_t genBuildTree(uint32_t);
+static uint8_t genAddLeaf(uint32_t);
+static uint8_t genCount(uint32_t);
+static uint8_t genWriteSource(const char *);
+static uint8_t genWriteHeader(const char *);
+
+/******************************************************************************
+* Private Global Variables
+******************************************************************************/
+static GEN_VECTOR_T genVectors[MAX_VECTORS];
+static uint16_t genNumVectors;
+
+static CHECKER_TREE_NODE_T genNodes[MAX_NODES];
+static uint8_t genNumNodes;
+
+static uint32_t genLeaves[MAX_LEAVES];
+static uint8_t genNumLeaves;
+
+static const PACKAGE_PINS_T genPackages[CHECKER_NUM_PACKAGES] = CHECKER_PACKAGE_PINS;
+// Number of pins and supply pins of each package, as used by the firmware
+
+static PIN_FIELD_T genIOField;
+// IO pins of TREE_PACKAGE, all but its supply pins (bit n corresponds to
+// package pin n)
+
+static uint32_t genCandidates;
+// Library ICs of TREE_PACKAGE
+
+static uint8_t genRoot;
+static uint8_t genDepth;
+static uint8_t genError;
+
+int main(int argc, char *argv[])
+{
+	if(argc != 3)
+	{
+		fprintf(stderr, "Usage: ICTreeGen <output .c path> <output .h path>\n");
+		return 1;
+	}
+
+	for(uint8_t ic_pin = 1; ic_pin <= genPackages[TREE_PACKAGE].num_pins; ic_pin++)
+	{
+		genIOField |= CHECKER_PIN(ic_pin);
+	}
+	genIOField &= ~(CHECKER_PIN(genPackages[TREE_PACKAGE].vcc_pin) | CHECKER_PIN(genPackages[TREE_PACKAGE].gnd_pin));
+
+	for(uint8_t lib_index = 0; lib_index < NUM_LIBRARY_ICS; lib_index++)
+	{
+		if(ICLibrary[lib_index].package == TREE_PACKAGE) genCandidates |= (1UL << lib_index);
+	}
+
+	genBuildVectors();
+	genRoot = genBuildTree(genCandidates);
+
+	if(genError != 0)
+	{
+		fprintf(stderr, "ICTreeGen: table limits exceeded\n");
+		return 1;
+	}
+
+	if(genWriteSource(argv[1]) != 0 || genWriteHeader(argv[2]) != 0)
+	{
+		fprintf(stderr, "ICTreeGen: could not write output files\n");
+		return 1;
+	}
+
+	printf("ICTreeGen: %u candidates, %u vectors, %u nodes, %u leaves, depth %u\n",
+		   genCount(genCandidates), genNumVectors, genNumNodes, genNumLeaves, genDepth);
+	return 0;
+}
+
+/********************************************************************
+* genAddVector - Adds a vector to the candidate vector list
+*
+* Description:  Vector is only added if not already in the list.
+*
+* Return value:	None
+*
+* Arguments:    PIN_FIELD_T drive_field - Pin field of driven pins
+*
+* 				PIN_FIELD_T level_field - Pin field of driven levels
+********************************************************************/
+static void genAddVector(PIN_FIELD_T drive_field, PIN_FIELD_T level_field)
+{
+	for(uint16_t vector_num = 0; vector_num < genNumVectors; vector_num++)
+	{
+		if(genVectors[vector_num].drive_field == drive_field &&
+		   genVectors[vector_num].level_field == level_field) return;
+	}
+
+	if(genNumVectors >= MAX_VECTORS)
+	{
+		genError = 1;
+		return;
+	}
+
+	genVectors[genNumVectors].drive_field = drive_field;
+	genVectors[genNumVectors].level_field = level_field;
+	genNumVectors++;
+}
+
+/********************************************************************
+* genBuildVectors - Creates every vector the tree may choose from
+*
+* Description:  For every candidate, a vector is created for each
+* 				input combination its group test gives it (see
+* 				checkerBuildVectors): every combination of a gate's
+* 				inputs, given to all gates at once when
+* 				CHECKER_PARALLEL_GATES is set, otherwise to one gate at
+* 				a time with other inputs held low, and enable pins at
+* 				their enable levels. Unlike the firmware's list, these
+* 				are in binary rather than Gray code order, and each
+* 				drives all of its own candidate's input and enable pins
+* 				(rather than the pins changed since the last vector), as
+* 				a tree node applies it on its own. Only vectors with the
+* 				same driven pins and levels are shared.
+*
+* Return value:	None
+*
+* Arguments:    None
+********************************************************************/
+static void genBuildVectors(void)
+{
+	const IC_PARAMETERS_T *IC;
+	PIN_FIELD_T drive_field;
+	PIN_FIELD_T level_field;
+	uint8_t num_inputs_gate;
+	uint8_t num_groups;
+	uint16_t gate_mask;
+
+	for(uint8_t lib_index = 0; lib_index < NUM_LIBRARY_ICS; lib_index++)
+	{
+		if(((genCandidates >> lib_index) & 0x01) == 0) continue;
+
+		IC = &ICLibrary[lib_index];
+		num_inputs_gate = IC->num_inputs/IC->num_outputs;
+		num_groups = (CHECKER_PARALLEL_GATES == TRUE) ? 1U : IC->num_outputs;
+
+		drive_field = IC->enable_field;
+		for(uint8_t input_num = 0; input_num < IC->num_inputs; input_num++)
+		{
+			drive_field |= (1UL << IC->input_pins[input_num]);
+		}
+
+		for(uint8_t group_num = 0; group_num < num_groups; group_num++)
+		{
+			gate_mask = (CHECKER_PARALLEL_GATES == TRUE) ? ((1U << IC->num_outputs) - 1U) : (1U << group_num);
+
+			for(uint8_t combo = 0; combo < (1U << num_inputs_gate); combo++)
+			{
+				level_field = IC->enable_levels;
+				for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+				{
+					if(((gate_mask >> gate_num) & 0x01) == 0) continue;
+
+					for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+					{
+						if((combo >> input_offset) & 0x01)
+						{
+							level_field |= (1UL << IC->input_pins[(gate_num*num_inputs_gate) + input_offset]);
+						}
+					}
+				}
+				genAddVector(drive_field, level_field);
+			}
+		}
+	}
+}
+
+/********************************************************************
+* genResponse - Finds a candidate's response on a read pin
+*
+* Description:  If the read pin is a gate output of the candidate,
+* 				its enable pins are driven to their enable levels, and
+* 				every input of that gate is driven by the vector, the
+* 				response is the gate's truth table output. Otherwise,
+* 				or for the high (Hi-Z) output of an open-drain gate,
+* 				the level read can not be predicted.
+*
+* Return value:	RESP_LOW, RESP_HIGH, or RESP_UNKNOWN
+*
+* Arguments:    const IC_PARAMETERS_T *IC - Candidate parameters
+*
+* 				const GEN_VECTOR_T *vector - Applied vector
+*
+* 				uint8_t read_pin - Package pin read
+********************************************************************/
+static uint8_t genResponse(const IC_PARAMETERS_T *IC, const GEN_VECTOR_T *vector, uint8_t read_pin)
+{
+	uint8_t num_inputs_gate = IC->num_inputs/IC->num_outputs;
+	const uint8_t *gate_pins;
+	uint8_t tt_index;
+	uint8_t response;
+
+	if((vector->drive_field & IC->enable_field) != IC->enable_field) return RESP_UNKNOWN;
+	if((vector->level_field & IC->enable_field) != IC->enable_levels) return RESP_UNKNOWN;
+
+	for(uint8_t gate_num = 0; gate_num < IC->num_outputs; gate_num++)
+	{
+		if(IC->output_pins[gate_num] != read_pin) continue;
+
+		gate_pins = &IC->input_pins[gate_num*num_inputs_gate];
+		tt_index = 0;
+		for(uint8_t input_offset = 0; input_offset < num_inputs_gate; input_offset++)
+		{
+			if(PIN_LEVEL(vector->drive_field, gate_pins[input_offset]) == 0) return RESP_UNKNOWN;
+			tt_index |= (PIN_LEVEL(vector->level_field, gate_pins[input_offset]) << input_offset);
+		}
+		response = ((IC->truth_table >> tt_index) & 0x01);
+		if((response == RESP_HIGH) && (IC->output_type == OUTPUT_OPEN_DRAIN)) return RESP_UNKNOWN;
+		return response;
+	}
+	return RESP_UNKNOWN;
+}
+
+/********************************************************************
+* genBuildTree - Recursively builds the decision tree
+*
+* Description:  Every vector and read pin pair is scored by the size
+* 				of the larger side it splits the candidates into.
+* 				Vectors driving an output pin of any candidate left are
+* 				skipped, as that candidate may be the inserted IC.
+* 				Candidates with an unknown response are kept on both
+* 				sides. The pair with the smallest larger side is chosen
+* 				(ties go to the fewest unknown responses), and each side
+* 				is built in turn. When one candidate is left, or no pair
+* 				splits the candidates, a leaf is created.
+*
+* Return value:	Link to created node or leaf
+*
+* Arguments:    uint32_t candidate_field - Candidates left
+********************************************************************/
+static uint8_t genBuildTree(uint32_t candidate_field)
+{
+	static uint8_t depth = 0;
+	uint32_t best_split[2] = {0, 0};
+	uint8_t best_worst = genCount(candidate_field);
+	uint8_t best_total = 0xFF;
+	uint16_t best_vector = 0;
+	uint8_t best_pin = 0;
+	uint32_t split[2];
+	uint8_t worst;
+	uint8_t total;
+	uint8_t response;
+	uint8_t node_index;
+	CHECKER_TREE_NODE_T *node;
+	PIN_FIELD_T output_field = 0x00000000;
+
+	if(genCount(candidate_field) <= 1) return genAddLeaf(candidate_field);
+
+	for(uint8_t lib_index = 0; lib_index < NUM_LIBRARY_ICS; lib_index++)
+	{
+		if(((candidate_field >> lib_index) & 0x01) != 0) output_field |= ICLibrary[lib_index].output_field;
+	}
+
+	for(uint16_t vector_num = 0; vector_num < genNumVectors; vector_num++)
+	{
+		if((genVectors[vector_num].drive_field & output_field) != 0) continue;
+
+		for(uint8_t read_pin = 1; read_pin <= genPackages[TREE_PACKAGE].num_pins; read_pin++)
+		{
+			if(PIN_LEVEL(genIOField, read_pin) == 0) continue;
+			if(PIN_LEVEL(genVectors[vector_num].drive_field, read_pin)) continue;
+
+			split[0] = 0;
+			split[1] = 0;
+			for(uint8_t lib_index = 0; lib_index < NUM_LIBRARY_ICS; lib_index++)
+			{
+				if(((candidate_field >> lib_index) & 0x01) == 0) continue;
+
+				response = genResponse(&ICLibrary[lib_index], &genVectors[vector_num], read_pin);
+				if(response != RESP_HIGH) split[0] |= (1UL << lib_index);
+				if(response != RESP_LOW) split[1] |= (1UL << lib_index);
+			}
+
+			worst = (genCount(split[0]) > genCount(split[1])) ? genCount(split[0]) : genCount(split[1]);
+			total = genCount(split[0]) + genCount(split[1]);
+
+			if(worst < best_worst || (worst == best_worst && total < best_total && worst < genCount(candidate_field)))
+			{
+				best_worst = worst;
+				best_total = total;
+				best_vector = vector_num;
+				best_pin = read_pin;
+				best_split[0] = split[0];
+				best_split[1] = split[1];
+			}
+		}
+	}
+
+	if(best_pin == 0) return genAddLeaf(candidate_field);
+
+	if(genNumNodes >= MAX_NODES)
+	{
+		genError = 1;
+		return CHECKER_TREE_LEAF;
+	}
+
+	node_index = genNumNodes++;
+	node = &genNodes[node_index];
+	node->drive_field = genVectors[best_vector].drive_field;
+	node->level_field = genVectors[best_vector].level_field;
+	node->read_pin = best_pin;
+
+	depth++;
+	if(depth > genDepth) genDepth = depth;
+	node->next[0] = genBuildTree(best_split[0]);
+	node->next[1] = genBuildTree(best_split[1]);
+	depth--;
+
+	return node_index;
+}
+
+/********************************************************************
+* genAddLeaf - Adds a leaf holding the remaining candidates
+*
+* Description:  Identical leaves are shared.
+*
+* Return value:	Link to leaf
+*
+* Arguments:    uint32_t candidate_field - Candidates left
+********************************************************************/
+static uint8_t genAddLeaf(uint32_t candidate_field)
+{
+	for(uint8_t leaf_num = 0; leaf_num < genNumLeaves; leaf_num++)
+	{
+		if(genLeaves[leaf_num] == candidate_field) return (CHECKER_TREE_LEAF | leaf_num);
+	}
+
+	if(genNumLeaves >= MAX_LEAVES)
+	{
+		genError = 1;
+		return CHECKER_TREE_LEAF;
+	}
+
+	genLeaves[genNumLeaves] = candidate_field;
+	return (CHECKER_TREE_LEAF | genNumLeaves++);
+}
+
+/********************************************************************
+* genCount - Counts candidates in a bit field
+*
+* Return value:	Number of set bits
+*
+* Arguments:    uint32_t candidate_field - Candidate bit field
+********************************************************************/
+static uint8_t genCount(uint32_t candidate_field)
+{
+	uint8_t count = 0;
+
+	while(candidate_field != 0)
+	{
+		candidate_field &= (candidate_field - 1);
+		count++;
+	}
+	return count;
+}
+
+/********************************************************************
+* genWriteSource - Writes node and leaf tables
+*
+* Return value:	Zero on success
+*
+* Arguments:    const char *path - Output file path
+********************************************************************/
+static uint8_t genWriteSource(const char *path)
+{
+	FILE *out = fopen(path, "wb");
+
+	if(out == NULL) return 1;
+
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* \tICTree.c\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tGenerated by Tools/ICTreeGen from ICLibrary. Do not edit.\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tMCU: STM32L053R8\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "#include <stdint.h>\r\n");
+	fprintf(out, "#include \"Checker.h\"\r\n");
+	fprintf(out, "#include \"ICTree.h\"\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* Public Constants\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "const CHECKER_TREE_NODE_T ICTree[IC_TREE_NUM_NODES] = {\r\n");
+	for(uint8_t node_index = 0; node_index < genNumNodes; node_index++)
+	{
+		fprintf(out, "\t{0x%04lX, 0x%04lX, %2u, {0x%02X, 0x%02X}}%s\r\n",
+				(unsigned long)genNodes[node_index].drive_field, (unsigned long)genNodes[node_index].level_field,
+				genNodes[node_index].read_pin, genNodes[node_index].next[0],
+				genNodes[node_index].next[1], (node_index + 1 < genNumNodes) ? "," : " };");
+	}
+	if(genNumNodes == 0) fprintf(out, "\t{0x0000, 0x0000, 0, {0x%02X, 0x%02X}} };\r\n", genRoot, genRoot);
+	fprintf(out, "// Decision tree nodes: drive field, level field, read pin, next links\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "const uint32_t ICTreeLeaves[IC_TREE_NUM_LEAVES] = {\r\n");
+	for(uint8_t leaf_num = 0; leaf_num < genNumLeaves; leaf_num++)
+	{
+		fprintf(out, "\t0x%08lX%s\r\n", (unsigned long)genLeaves[leaf_num],
+				(leaf_num + 1 < genNumLeaves) ? "," : " };");
+	}
+	fprintf(out, "// Candidate bit fields left at each leaf\r\n");
+
+	return (fclose(out) != 0);
+}
+
+/********************************************************************
+* genWriteHeader - Writes table sizes, root link and declarations
+*
+* Return value:	Zero on success
+*
+* Arguments:    const char *path - Output file path
+********************************************************************/
+static uint8_t genWriteHeader(const char *path)
+{
+	FILE *out = fopen(path, "wb");
+
+	if(out == NULL) return 1;
+
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* \tICTree.h\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tGenerated by Tools/ICTreeGen from ICLibrary. Do not edit.\r\n");
+	fprintf(out, "*\r\n");
+	fprintf(out, "* \tMCU: STM32L053R8\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "#ifndef ICTREE_H_\r\n");
+	fprintf(out, "#define ICTREE_H_\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* Public Definitions\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "#define IC_TREE_NUM_NODES %u\r\n", (genNumNodes > 0) ? genNumNodes : 1U);
+	fprintf(out, "#define IC_TREE_NUM_LEAVES %u\r\n", genNumLeaves);
+	fprintf(out, "#define IC_TREE_ROOT 0x%02X\r\n", genRoot);
+	fprintf(out, "#define IC_TREE_DEPTH %u\r\n", genDepth);
+	fprintf(out, "// Table sizes, link to first node, and most nodes visited in one walk\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "#define IC_TREE_PACKAGE %s\r\n", GEN_NAME(TREE_PACKAGE));
+	fprintf(out, "#define IC_TREE_CANDIDATES 0x%08lX\r\n", (unsigned long)genCandidates);
+	fprintf(out, "// Package the tree is built for, and bit field of the library ICs it\r\n");
+	fprintf(out, "// identifies. Other ICs of the package are not covered by the tree.\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "/******************************************************************************\r\n");
+	fprintf(out, "* Public Constants\r\n");
+	fprintf(out, "******************************************************************************/\r\n");
+	fprintf(out, "extern const CHECKER_TREE_NODE_T ICTree[IC_TREE_NUM_NODES];\r\n");
+	fprintf(out, "extern const uint32_t ICTreeLeaves[IC_TREE_NUM_LEAVES];\r\n");
+	fprintf(out, "\r\n");
+	fprintf(out, "#endif /* ICTREE_H_ */\r\n");
+
+	return (fclose(out) != 0);
+}